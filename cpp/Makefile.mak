@@ -29,6 +29,9 @@ install:: install-common
 test::
 	@python $(top_srcdir)/allTests.py
 
+bench::
+	@cd $(top_srcdir)\test\Ice\bench && python run.py
+
 !else
 
 SUBDIRS		= src include test
@@ -77,6 +77,8 @@ tests = [
     ("Ice/enums", ["once"]),
     ("Ice/logger", ["once"]),
     ("Ice/networkProxy", ["core", "noipv6", "nosocks"]),
+    ("Ice/tracing", ["core", "noipv6"]),
+    ("Ice/coalesce", ["core", "nocompress"]),
     ("Ice/services", ["once"]),
     ("IceSSL/configuration", ["once", "novalgrind"]), # valgrind doesn't work well with openssl
     ("IceBox/configuration", ["core", "noipv6", "novc100", "nomingw", "nomx"]),
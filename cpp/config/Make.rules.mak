@@ -46,6 +46,16 @@ prefix			= $(PREFIX)
 #
 # MCPP_HOME		= C:\mcpp
 
+#
+# Define USE_ZLIB as yes if you want to build the WebSocket transport
+# with support for the permessage-deflate extension, an optional
+# feature that requires zlib. If zlib is not installed in the third
+# party location, set ZLIB_HOME to the zlib installation directory,
+# this also enables it.
+#
+#USE_ZLIB		= yes
+#ZLIB_HOME		= C:\zlib
+
 #
 # If third party libraries are not installed in the default location
 # or THIRDPARTY_HOME is not set in your environment variables then
@@ -192,6 +202,15 @@ ICE_OS_LIBS             = advapi32.lib ws2_32.lib Iphlpapi.lib
 SSL_OS_LIBS             = advapi32.lib secur32.lib crypt32.lib ws2_32.lib
 
 BZIP2_LIBS              = libbz2$(LIBSUFFIX).lib
+!if "$(ZLIB_HOME)" != ""
+USE_ZLIB                = yes
+ZLIB_FLAGS              = -I"$(ZLIB_HOME)\include"
+LDFLAGS                 = $(PRELIBPATH)"$(ZLIB_HOME)\lib$(libsuff)" $(LDFLAGS)
+!endif
+!if "$(USE_ZLIB)" == "yes"
+ZLIB_FLAGS              = -DICE_HAS_ZLIB $(ZLIB_FLAGS)
+ZLIB_LIBS               = zlib$(LIBSUFFIX).lib
+!endif
 DB_LIBS                 = libdb53$(LIBSUFFIX).lib
 !if "$(MCPP_HOME)" != ""
 MCPP_LIBS               = $(MCPP_HOME)/mcpp$(LIBSUFFIX).lib
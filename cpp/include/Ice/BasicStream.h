@@ -493,11 +493,40 @@ public:
     template<typename T> void write(const T* begin, const T* end)
     {
         writeSize(static_cast<Ice::Int>(end - begin));
+#ifndef ICE_BIG_ENDIAN
+        if(Ice::StreamBulkCopyable<T>::value && static_cast<int>(sizeof(T)) == Ice::StreamableTraits<T>::minWireSize)
+        {
+            if(begin != end)
+            {
+                Container::size_type sz = static_cast<Container::size_type>(end - begin) * sizeof(T);
+                writeBlob(reinterpret_cast<const Ice::Byte*>(begin), sz);
+            }
+            return;
+        }
+#endif
         for(const T* p = begin; p != end; ++p)
         {
             write(*p);
         }
     }
+    template<typename T> void read(std::vector<T>& v)
+    {
+#ifndef ICE_BIG_ENDIAN
+        if(Ice::StreamBulkCopyable<T>::value && static_cast<int>(sizeof(T)) == Ice::StreamableTraits<T>::minWireSize)
+        {
+            Ice::Int sz = readAndCheckSeqSize(static_cast<int>(sizeof(T)));
+            std::vector<T>(sz).swap(v);
+            if(sz > 0)
+            {
+                const Ice::Byte* p;
+                readBlob(p, sz * sizeof(T));
+                memcpy(static_cast<void*>(&v[0]), p, sz * sizeof(T));
+            }
+            return;
+        }
+#endif
+        Ice::StreamHelper<std::vector<T>, Ice::StreamableTraits<std::vector<T> >::helper>::read(this, v);
+    }
 
     // Read/write type and tag for optionals
     bool writeOpt(Ice::Int tag, Ice::OptionalFormat format)
@@ -916,8 +945,10 @@ private:
 
     protected:
 
-        EncapsDecoder(BasicStream* stream, ReadEncaps* encaps, bool sliceObjects, const ObjectFactoryManagerPtr& f) :
-            _stream(stream), _encaps(encaps), _sliceObjects(sliceObjects), _servantFactoryManager(f), _typeIdIndex(0)
+        EncapsDecoder(BasicStream* stream, ReadEncaps* encaps, bool sliceObjects, const ObjectFactoryManagerPtr& f,
+                      Ice::Int firstIndex) :
+            _stream(stream), _encaps(encaps), _sliceObjects(sliceObjects), _servantFactoryManager(f),
+            _firstIndex(firstIndex), _defaultFactoryResolved(false)
         {
         }
 
@@ -928,7 +959,14 @@ private:
         void unmarshal(Ice::Int, const Ice::ObjectPtr&);
 
         typedef std::map<Ice::Int, Ice::ObjectPtr> IndexToPtrMap;
-        typedef std::map<Ice::Int, std::string> TypeIdReadMap;
+        typedef std::vector<std::string> TypeIdReadList;
+
+        struct FactoryCacheEntry
+        {
+            Ice::ObjectFactoryPtr userFactory;
+            Ice::ObjectFactoryPtr staticFactory;
+        };
+        typedef std::map<std::string, FactoryCacheEntry> FactoryCache;
 
         struct PatchEntry
         {
@@ -949,9 +987,13 @@ private:
     private:
 
         // Encapsulation attributes for object un-marshalling
-        IndexToPtrMap _unmarshaledMap;
-        TypeIdReadMap _typeIdMap;
-        Ice::Int _typeIdIndex;
+        const Ice::Int _firstIndex; // The index of the first object in the encapsulation.
+        ObjectList _unmarshaledList; // Objects with indexes _firstIndex..n, in order.
+        IndexToPtrMap _unmarshaledMap; // Objects with out of sequence indexes.
+        TypeIdReadList _typeIdList;
+        FactoryCache _factoryCache;
+        Ice::ObjectFactoryPtr _defaultFactory;
+        bool _defaultFactoryResolved;
         ObjectList _objectList;
     };
 
@@ -960,7 +1002,7 @@ private:
     public:
 
         EncapsDecoder10(BasicStream* stream, ReadEncaps* encaps, bool sliceObjects, const ObjectFactoryManagerPtr& f) :
-            EncapsDecoder(stream, encaps, sliceObjects, f), _sliceType(NoSlice)
+            EncapsDecoder(stream, encaps, sliceObjects, f, 1), _sliceType(NoSlice)
         {
         }
 
@@ -993,7 +1035,7 @@ private:
     public:
 
         EncapsDecoder11(BasicStream* stream, ReadEncaps* encaps, bool sliceObjects, const ObjectFactoryManagerPtr& f) :
-            EncapsDecoder(stream, encaps, sliceObjects, f), _preAllocatedInstanceData(0), _current(0), _objectIdIndex(1)
+            EncapsDecoder(stream, encaps, sliceObjects, f, 2), _preAllocatedInstanceData(0), _current(0), _objectIdIndex(1)
         {
         }
 
@@ -16,6 +16,9 @@
 
 #include <Ice/Metrics.h>
 
+#include <IceUtil/Atomic.h>
+#include <IceUtil/ScopedArray.h>
+
 #ifdef _MSC_VER
 #  define ICE_CPP11_REGEXP
 #endif
@@ -39,11 +42,109 @@ namespace IceMX
 class Updater;
 template<typename T> class MetricsHelperT;
 
+//
+// Add the counters of the second metrics object to the first one and
+// return the first one. This is used to merge the per-thread shards of
+// sharded metrics maps, a metrics type must provide its own overload
+// for its maps to be sharded.
+//
+ICE_API Metrics& mergeMetrics(Metrics&, const Metrics&);
+ICE_API ThreadMetrics& mergeMetrics(ThreadMetrics&, const ThreadMetrics&);
+ICE_API DispatchMetrics& mergeMetrics(DispatchMetrics&, const DispatchMetrics&);
+ICE_API ChildInvocationMetrics& mergeMetrics(ChildInvocationMetrics&, const ChildInvocationMetrics&);
+ICE_API RemoteMetrics& mergeMetrics(RemoteMetrics&, const RemoteMetrics&);
+ICE_API CollocatedMetrics& mergeMetrics(CollocatedMetrics&, const CollocatedMetrics&);
+ICE_API InvocationMetrics& mergeMetrics(InvocationMetrics&, const InvocationMetrics&);
+ICE_API ConnectionMetrics& mergeMetrics(ConnectionMetrics&, const ConnectionMetrics&);
+
+//
+// Checks if mergeMetrics is overloaded for the given metrics type. The
+// overload of a base type would drop the counters of the derived type.
+//
+template<typename T> class MergeMetricsCheck
+{
+    static char check(T*);
+    static long check(...);
+    static T& metrics();
+
+public:
+
+    enum { value = sizeof(check(&mergeMetrics(metrics(), metrics()))) == sizeof(char) };
+};
+
+//
+// Visitor for the counters and gauges of a metrics object, used to
+// expose the metrics without creating Slice snapshots. The names are
+// lower case with words separated by underscores. Metrics types which
+// define additional counters or gauges must provide a visitMetrics
+// overload.
+//
+class ICE_API MetricsVisitor
+{
+public:
+
+    virtual ~MetricsVisitor();
+
+    virtual void counter(const char*, Ice::Long) = 0;
+    virtual void gauge(const char*, Ice::Long) = 0;
+};
+
+ICE_API void visitMetrics(const Metrics&, MetricsVisitor&);
+ICE_API void visitMetrics(const ThreadMetrics&, MetricsVisitor&);
+ICE_API void visitMetrics(const DispatchMetrics&, MetricsVisitor&);
+ICE_API void visitMetrics(const ChildInvocationMetrics&, MetricsVisitor&);
+ICE_API void visitMetrics(const InvocationMetrics&, MetricsVisitor&);
+ICE_API void visitMetrics(const ConnectionMetrics&, MetricsVisitor&);
+
 }
 
 namespace IceInternal
 {
 
+//
+// Writes metrics in the OpenMetrics text exposition format. The
+// samples are grouped by metric family as the format requires.
+//
+class ICE_API OpenMetricsWriter
+{
+public:
+
+    class ICE_API Visitor : public IceMX::MetricsVisitor
+    {
+    public:
+
+        Visitor(OpenMetricsWriter&, const std::string&, const std::string&);
+
+        virtual void counter(const char*, Ice::Long);
+        virtual void gauge(const char*, Ice::Long);
+
+    private:
+
+        OpenMetricsWriter& _writer;
+        const std::string& _family;
+        const std::string& _labels;
+    };
+
+    void addFailures(const std::string&, const std::string&, const IceMX::StringIntDict&);
+    void addHistogram(const std::string&, const std::string&, const Ice::LongSeq&, Ice::Long);
+
+    std::string str() const;
+
+    static std::string escape(const std::string&);
+    static std::string toName(const std::string&);
+
+private:
+
+    void add(const std::string&, const char*, const std::string&, const std::string&, Ice::Long);
+
+    struct Family
+    {
+        std::string type;
+        std::string samples;
+    };
+    std::map<std::string, Family> _families;
+};
+
 class ICE_API MetricsMapI : public IceUtil::Shared
 {
 public:
@@ -93,7 +194,7 @@ public:
     };
     typedef IceUtil::Handle<RegExp> RegExpPtr;
 
-    MetricsMapI(const std::string&, const Ice::PropertiesPtr&);
+    MetricsMapI(const std::string&, const Ice::PropertiesPtr&, bool);
     MetricsMapI(const MetricsMapI&);
 
     virtual void destroy() = 0;
@@ -104,8 +205,31 @@ public:
 
     virtual MetricsMapI* clone() const = 0;
 
+    //
+    // Write the metrics of the map, the arguments are the name of the
+    // map, the name of its metric families and the labels common to
+    // all the samples.
+    //
+    virtual void writeOpenMetrics(OpenMetricsWriter&, const std::string&, const std::string&,
+                                  const std::string&) const = 0;
+
     const Ice::PropertyDict& getProperties() const;
 
+    //
+    // Lifetime histogram helpers, see IceMX::Metrics::lifetimeHistogram
+    // for the bucket layout.
+    //
+    static void addToHistogram(Ice::LongSeq&, Ice::Long);
+    static void mergeHistogram(Ice::LongSeq&, const Ice::LongSeq&);
+    static Ice::Long getUpperBound(size_t);
+    static IceMX::StringLongDict getQuantiles(const Ice::LongSeq&);
+
+    //
+    // Returns a small number identifying the calling thread, used to
+    // pick the shard of sharded maps.
+    //
+    static size_t getThreadIndex();
+
 protected:
 
     const Ice::PropertyDict _properties;
@@ -114,6 +238,8 @@ protected:
     const int _retain;
     const std::vector<RegExpPtr> _accept;
     const std::vector<RegExpPtr> _reject;
+    const bool _histogram;
+    const int _shards;
 };
 typedef IceUtil::Handle<MetricsMapI> MetricsMapIPtr;
 
@@ -154,6 +280,10 @@ public:
         EntryT(MetricsMapT* map, const TPtr& object, const typename std::list<EntryTPtr>::iterator& p) : 
             _map(map), _object(object), _detachedPos(p)
         {
+            if(_map->_shards > 0)
+            {
+                _shards.reset(new Shard[_map->_shards]);
+            }
         }
 
         ~EntryT()
@@ -169,6 +299,15 @@ public:
         void  
         failed(const std::string& exceptionName)
         {
+            if(_shards.get())
+            {
+                Shard& shard = getShard();
+                IceUtil::Mutex::Lock sync(shard);
+                ++shard.getObject()->failures;
+                ++shard.failures[exceptionName];
+                return;
+            }
+
             IceUtil::Mutex::Lock sync(*_map);
             ++_object->failures;
             ++_failures[exceptionName];
@@ -205,8 +344,40 @@ public:
         void
         detach(Ice::Long lifetime)
         {
+            if(_shards.get())
+            {
+                {
+                    Shard& shard = getShard();
+                    IceUtil::Mutex::Lock sync(shard);
+                    shard.getObject()->totalLifetime += lifetime;
+                    if(_map->_histogram)
+                    {
+                        MetricsMapI::addToHistogram(shard.lifetimes, lifetime);
+                    }
+                }
+
+                //
+                // The map mutex is only needed when the entry is no longer
+                // observed. It's checked again with the mutex locked since
+                // the entry can be attached again concurrently.
+                //
+                if(--_current == 0)
+                {
+                    IceUtil::Mutex::Lock sync(*_map);
+                    if(_current == 0)
+                    {
+                        _map->detached(this);
+                    }
+                }
+                return;
+            }
+
             IceUtil::Mutex::Lock sync(*_map);
             _object->totalLifetime += lifetime;
+            if(_map->_histogram)
+            {
+                MetricsMapI::addToHistogram(_lifetimes, lifetime);
+            }
             if(--_object->current == 0)
             {
                 _map->detached(this);
@@ -215,6 +386,27 @@ public:
 
         template<typename Function> void
         execute(Function func)
+        {
+            if(_shards.get())
+            {
+                Shard& shard = getShard();
+                IceUtil::Mutex::Lock sync(shard);
+                func(shard.getObject());
+                return;
+            }
+
+            IceUtil::Mutex::Lock sync(*_map);
+            func(_object);
+        }
+
+        //
+        // Gauges which are decremented with a lower bound must be
+        // updated with this method rather than execute(): the update
+        // must see the value resulting from the updates of all the
+        // threads so it's never applied to a shard.
+        //
+        template<typename Function> void
+        executeUnsharded(Function func)
         {
             IceUtil::Mutex::Lock sync(*_map);
             func(_object);
@@ -228,6 +420,35 @@ public:
 
     private:
 
+        //
+        // With sharded maps, the counters updated once the entry is
+        // attached are accumulated in the shard of the calling thread
+        // and only merged when the metrics are retrieved.
+        //
+        class Shard : public IceUtil::Mutex
+        {
+        public:
+
+            const TPtr&
+            getObject()
+            {
+                if(!object)
+                {
+                    object = new T();
+                }
+                return object;
+            }
+
+            TPtr object;
+            IceMX::StringIntDict failures;
+            Ice::LongSeq lifetimes;
+        };
+
+        Shard&
+        getShard()
+        {
+            return _shards[MetricsMapI::getThreadIndex() % _map->_shards];
+        }
 
         IceMX::MetricsFailures
         getFailures() const
@@ -235,32 +456,119 @@ public:
             IceMX::MetricsFailures f;
             f.id = _object->id;
             f.failures = _failures;
+            if(_shards.get())
+            {
+                for(int i = 0; i < _map->_shards; ++i)
+                {
+                    IceUtil::Mutex::Lock sync(_shards[i]);
+                    for(IceMX::StringIntDict::const_iterator p = _shards[i].failures.begin(); 
+                        p != _shards[i].failures.end(); ++p)
+                    {
+                        f.failures[p->first] += p->second;
+                    }
+                }
+            }
             return f;
         }
 
         IceMX::MetricsPtr
         clone() const
         {
-            TPtr metrics = TPtr::dynamicCast(_object->ice_clone());
+            Ice::LongSeq lifetimes;
+            TPtr metrics = merge(lifetimes);
             for(typename std::map<std::string, std::pair<MetricsMapIPtr, SubMapMember> >::const_iterator p =
                     _subMaps.begin(); p != _subMaps.end(); ++p)
             {
                 metrics.get()->*p->second.second = p->second.first->getMetrics();
             }
+            if(!lifetimes.empty())
+            {
+                metrics->lifetimeHistogram = lifetimes;
+                metrics->lifetimeQuantiles = MetricsMapI::getQuantiles(lifetimes);
+            }
+            return metrics;
+        }
+
+        //
+        // Returns a copy of the metrics object with the shards merged in.
+        //
+        TPtr
+        merge(Ice::LongSeq& lifetimes) const
+        {
+            TPtr metrics = TPtr::dynamicCast(_object->ice_clone());
+            lifetimes = _lifetimes;
+            if(_shards.get())
+            {
+                metrics->current = _current;
+                for(int i = 0; i < _map->_shards; ++i)
+                {
+                    IceUtil::Mutex::Lock sync(_shards[i]);
+                    if(_shards[i].object)
+                    {
+                        mergeMetrics(*metrics, *_shards[i].object);
+                        MetricsMapI::mergeHistogram(lifetimes, _shards[i].lifetimes);
+                    }
+                }
+            }
             return metrics;
         }
 
+        void
+        writeOpenMetrics(OpenMetricsWriter& writer, const std::string& name, const std::string& family,
+                         const std::string& labels) const
+        {
+            const std::string entryLabels = labels + "id=\"" + OpenMetricsWriter::escape(_object->id) + "\"";
+
+            //
+            // Unless the entry is sharded, the counters are written from
+            // the metrics object directly rather than from a copy.
+            //
+            TPtr merged;
+            Ice::LongSeq mergedLifetimes;
+            const T* metrics = _object.get();
+            const Ice::LongSeq* lifetimes = &_lifetimes;
+            if(_shards.get())
+            {
+                merged = merge(mergedLifetimes);
+                metrics = merged.get();
+                lifetimes = &mergedLifetimes;
+            }
+
+            OpenMetricsWriter::Visitor visitor(writer, family, entryLabels);
+            visitMetrics(*metrics, visitor);
+            writer.addFailures(family, entryLabels, getFailures().failures);
+            if(_map->_histogram)
+            {
+                writer.addHistogram(family, entryLabels, *lifetimes, metrics->totalLifetime);
+            }
+
+            const std::string subMapLabels = labels + name + "=\"" + OpenMetricsWriter::escape(_object->id) + "\",";
+            for(typename std::map<std::string, std::pair<MetricsMapIPtr, SubMapMember> >::const_iterator p =
+                    _subMaps.begin(); p != _subMaps.end(); ++p)
+            {
+                const std::string subMapName = OpenMetricsWriter::toName(p->first);
+                p->second.first->writeOpenMetrics(writer, subMapName, family + "_" + subMapName, subMapLabels);
+            }
+        }
+
         bool 
         isDetached() const
         {
-            return _object->current == 0;
+            return _shards.get() ? _current == 0 : _object->current == 0;
         }
 
         void
         attach(const IceMX::MetricsHelperT<T>& helper)
         {
             ++_object->total;
-            ++_object->current;
+            if(_shards.get())
+            {
+                ++_current;
+            }
+            else
+            {
+                ++_object->current;
+            }
             helper.initMetrics(_object);
         }
 
@@ -268,14 +576,17 @@ public:
         MetricsMapTPtr _map;
         TPtr _object;
         IceMX::StringIntDict _failures;
+        Ice::LongSeq _lifetimes;
         std::map<std::string, std::pair<MetricsMapIPtr, SubMapMember> > _subMaps;
         typename std::list<EntryTPtr>::iterator _detachedPos;
+        IceUtil::ScopedArray<Shard> _shards;
+        IceUtilInternal::Atomic _current;
     };
 
     MetricsMapT(const std::string& mapPrefix,
                 const Ice::PropertiesPtr& properties,
                 const std::map<std::string, std::pair<SubMapMember, MetricsMapFactoryPtr> >& subMaps) : 
-        MetricsMapI(mapPrefix, properties), _destroyed(false)
+        MetricsMapI(mapPrefix, properties, IceMX::MergeMetricsCheck<MetricsType>::value), _destroyed(false)
     {
         std::vector<std::string> subMapNames;
         typename std::map<std::string, std::pair<SubMapMember, MetricsMapFactoryPtr> >::const_iterator p;
@@ -327,6 +638,17 @@ public:
         return objects;
     }
     
+    virtual void
+    writeOpenMetrics(OpenMetricsWriter& writer, const std::string& name, const std::string& family,
+                     const std::string& labels) const
+    {
+        Lock sync(*this);
+        for(typename std::map<std::string, EntryTPtr>::const_iterator p = _objects.begin(); p != _objects.end(); ++p)
+        {
+            p->second->writeOpenMetrics(writer, name, family, labels);
+        }
+    }
+
     virtual IceMX::MetricsFailuresSeq
     getFailures()
     {
@@ -557,6 +879,7 @@ public:
     bool removeMap(const std::string&);
 
     IceMX::MetricsView getMetrics();
+    void writeOpenMetrics(OpenMetricsWriter&) const;
     IceMX::MetricsFailuresSeq getFailures(const std::string&);
     IceMX::MetricsFailures getFailures(const std::string&, const std::string&);
 
@@ -635,6 +958,12 @@ public:
     virtual IceMX::MetricsFailures getMetricsFailures(const std::string&, const std::string&, const std::string&,
                                                       const ::Ice::Current&);
 
+    //
+    // Returns the metrics of all the enabled views in the OpenMetrics
+    // text exposition format.
+    //
+    std::string getOpenMetrics() const;
+
     std::vector<MetricsMapIPtr> getMaps(const std::string&) const;
 
     const Ice::LoggerPtr& getLogger() const;
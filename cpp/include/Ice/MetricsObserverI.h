@@ -356,6 +356,15 @@ public:
         }
     }
 
+    template<typename Function> void
+    forEachUnsharded(const Function& func)
+    {
+        for(typename EntrySeqType::const_iterator p = _objects.begin(); p != _objects.end(); ++p)
+        {
+            (*p)->executeUnsharded(func);
+        }
+    }
+
     void
     init(const MetricsHelperT<MetricsType>& /*helper*/, EntrySeqType& objects, ObserverT* previous = 0)
     {
@@ -17,6 +17,8 @@
 namespace IceInternal
 {
 
+class TraceSpan;
+
 template<typename T = Ice::Instrumentation::Observer> class ObserverHelperT
 {
 public:
@@ -96,16 +98,73 @@ protected:
     TPtr _observer;
 };
 
+//
+// The dispatch and invocation observer helpers also record the span
+// of the dispatch or invocation if it's sampled by the request tracer.
+//
 class ICE_API DispatchObserver : public ObserverHelperT<Ice::Instrumentation::DispatchObserver>
 {
 public:
-    
+
+    DispatchObserver() : _span(0)
+    {
+    }
+
+    ~DispatchObserver()
+    {
+        if(_span)
+        {
+            finishSpan();
+        }
+    }
+
+    void startSpan(Instance*, const Ice::Current&);
+
+    TraceSpan* getSpan() const
+    {
+        return _span;
+    }
+
+    operator bool() const
+    {
+        return _observer || _span;
+    }
+
+    void adopt(DispatchObserver& other)
+    {
+        ObserverHelperT<Ice::Instrumentation::DispatchObserver>::adopt(other);
+        _span = other._span;
+        other._span = 0;
+    }
+
+    void detach()
+    {
+        ObserverHelperT<Ice::Instrumentation::DispatchObserver>::detach();
+        if(_span)
+        {
+            finishSpan();
+        }
+    }
+
+    void failed(const std::string& reason)
+    {
+        ObserverHelperT<Ice::Instrumentation::DispatchObserver>::failed(reason);
+        if(_span)
+        {
+            spanFailed(reason);
+        }
+    }
+
     void userException()
     {
         if(_observer)
         {
             _observer->userException();
         }
+        if(_span)
+        {
+            spanUserException();
+        }
     }
 
     void reply(Ice::Int size)
@@ -115,6 +174,17 @@ public:
             _observer->reply(size);
         }
     }
+
+private:
+
+    DispatchObserver(const DispatchObserver&);
+    void operator=(const DispatchObserver&);
+
+    void finishSpan();
+    void spanFailed(const std::string&);
+    void spanUserException();
+
+    TraceSpan* _span;
 };
 
 class ICE_API InvocationObserver : public ObserverHelperT<Ice::Instrumentation::InvocationObserver>
@@ -123,13 +193,44 @@ public:
 
     InvocationObserver(IceProxy::Ice::Object*, const std::string&, const Ice::Context*);
     InvocationObserver(Instance*, const std::string&);
-    InvocationObserver()
+    InvocationObserver() : _span(0)
     {
     }
 
+    ~InvocationObserver()
+    {
+        if(_span)
+        {
+            finishSpan();
+        }
+    }
+
     void attach(IceProxy::Ice::Object*, const std::string&, const Ice::Context*);
     void attach(Instance*, const std::string&);
 
+    TraceSpan* getSpan() const
+    {
+        return _span;
+    }
+
+    void detach()
+    {
+        ObserverHelperT<Ice::Instrumentation::InvocationObserver>::detach();
+        if(_span)
+        {
+            finishSpan();
+        }
+    }
+
+    void failed(const std::string& reason)
+    {
+        ObserverHelperT<Ice::Instrumentation::InvocationObserver>::failed(reason);
+        if(_span)
+        {
+            spanFailed(reason);
+        }
+    }
+
     void retried()
     {
         if(_observer)
@@ -165,11 +266,26 @@ public:
         {
             _observer->userException();
         }
+        if(_span)
+        {
+            spanUserException();
+        }
     }
 
 private:
 
+    InvocationObserver(const InvocationObserver&);
+    void operator=(const InvocationObserver&);
+
     using ObserverHelperT<Ice::Instrumentation::InvocationObserver>::attach;
+    using ObserverHelperT<Ice::Instrumentation::InvocationObserver>::adopt;
+
+    void startSpan(IceProxy::Ice::Object*, const std::string&);
+    void finishSpan();
+    void spanFailed(const std::string&);
+    void spanUserException();
+
+    TraceSpan* _span;
 };
 
 }
@@ -104,6 +104,7 @@ protected:
                            const Ice::LocalObjectPtr&);
 
     void invokeImpl(bool);
+    virtual bool selectRequestHandler() const;
 
     bool sent(bool);
     bool finished(const Ice::Exception&);
@@ -213,6 +214,10 @@ public:
     virtual AsyncStatus invokeCollocated(CollocatedRequestHandler*);
 
     void invoke();
+
+protected:
+
+    virtual bool selectRequestHandler() const;
 };
 typedef IceUtil::Handle<ProxyGetConnection> ProxyGetConnectionPtr;
 
@@ -844,7 +844,7 @@ public:
     void __invoke(::IceInternal::Outgoing&) const;
     void __end(const ::Ice::AsyncResultPtr&, const std::string&) const;
 
-    ::IceInternal::RequestHandlerPtr __getRequestHandler();
+    ::IceInternal::RequestHandlerPtr __getRequestHandler(bool = true);
     ::IceInternal::BatchRequestQueuePtr __getBatchRequestQueue();
     ::IceInternal::RequestHandlerPtr __setRequestHandler(const ::IceInternal::RequestHandlerPtr&);
     void __updateRequestHandler(const ::IceInternal::RequestHandlerPtr&, const ::IceInternal::RequestHandlerPtr&);
@@ -249,6 +249,20 @@ struct StreamableTraits< ::IceInternal::Handle<T> >
     static const bool fixedLength = false;
 };
 
+//
+// StreamBulkCopyable<T>::value is true if the in-memory layout of T
+// matches its little-endian wire layout. slice2cpp specializes it
+// for structs which only contain byte, short, int, long, float,
+// double or such structs and which don't require any padding. The
+// streams use it to marshal sequences of these structs with a single
+// copy.
+//
+template<typename T>
+struct StreamBulkCopyable
+{
+    static const bool value = false;
+};
+
 //
 // StreamHelper templates used by streams to read and write data.
 //
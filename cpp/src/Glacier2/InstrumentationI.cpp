@@ -140,10 +140,41 @@ struct ForwardedUpdate
 
 }
 
+SessionMetrics&
+IceMX::mergeMetrics(SessionMetrics& m, const SessionMetrics& other)
+{
+    mergeMetrics(static_cast<Metrics&>(m), other);
+    m.forwardedClient += other.forwardedClient;
+    m.forwardedServer += other.forwardedServer;
+    m.routingTableSize += other.routingTableSize;
+    m.queuedClient += other.queuedClient;
+    m.queuedServer += other.queuedServer;
+    m.overriddenClient += other.overriddenClient;
+    m.overriddenServer += other.overriddenServer;
+    return m;
+}
+
+void
+IceMX::visitMetrics(const SessionMetrics& m, MetricsVisitor& visitor)
+{
+    visitMetrics(static_cast<const Metrics&>(m), visitor);
+    visitor.counter("forwarded_client", m.forwardedClient);
+    visitor.counter("forwarded_server", m.forwardedServer);
+    visitor.gauge("routing_table_size", m.routingTableSize);
+    visitor.gauge("queued_client", m.queuedClient);
+    visitor.gauge("queued_server", m.queuedServer);
+    visitor.counter("overridden_client", m.overriddenClient);
+    visitor.counter("overridden_server", m.overriddenServer);
+}
+
 void
 SessionObserverI::forwarded(bool client)
 {
-    forEach(ForwardedUpdate(client));
+    //
+    // Forwarding decrements the queued gauges with a lower bound, these
+    // gauges can't be updated in per-thread shards.
+    //
+    forEachUnsharded(ForwardedUpdate(client));
 }
 
 void
@@ -151,11 +182,11 @@ SessionObserverI::queued(bool client)
 {
     if(client)
     {
-        forEach(inc(&SessionMetrics::queuedClient));
+        forEachUnsharded(inc(&SessionMetrics::queuedClient));
     }
     else
     {
-        forEach(inc(&SessionMetrics::queuedServer));
+        forEachUnsharded(inc(&SessionMetrics::queuedServer));
     }
 }
 
@@ -15,6 +15,14 @@
 #include <Glacier2/Instrumentation.h>
 #include <Glacier2/Metrics.h>
 
+namespace IceMX
+{
+
+SessionMetrics& mergeMetrics(SessionMetrics&, const SessionMetrics&);
+void visitMetrics(const SessionMetrics&, MetricsVisitor&);
+
+}
+
 namespace Glacier2
 {
 
@@ -1887,19 +1887,21 @@ IceInternal::BasicStream::EncapsDecoder::readTypeId(bool isIndex)
 {
     if(isIndex)
     {
+        //
+        // Type ID indexes are allocated sequentially starting at 1.
+        //
         Int index = _stream->readSize();
-        TypeIdReadMap::const_iterator k = _typeIdMap.find(index);
-        if(k == _typeIdMap.end())
+        if(index < 1 || static_cast<size_t>(index) > _typeIdList.size())
         {
             throw UnmarshalOutOfBoundsException(__FILE__, __LINE__);
         }
-        return k->second;
+        return _typeIdList[static_cast<size_t>(index - 1)];
     }
     else
     {
         string typeId;
         _stream->read(typeId, false);
-        _typeIdMap.insert(make_pair(++_typeIdIndex, typeId));
+        _typeIdList.push_back(typeId);
         return typeId;
     }
 }
@@ -1909,13 +1911,25 @@ IceInternal::BasicStream::EncapsDecoder::newInstance(const string& typeId)
 {
     Ice::ObjectPtr v;
 
+    //
+    // The factory lookups below each acquire a lock, so we resolve
+    // them once per type ID for the lifetime of this encapsulation.
+    //
+    FactoryCache::iterator p = _factoryCache.find(typeId);
+    if(p == _factoryCache.end())
+    {
+        FactoryCacheEntry entry;
+        entry.userFactory = _servantFactoryManager->find(typeId);
+        entry.staticFactory = IceInternal::factoryTable->getObjectFactory(typeId);
+        p = _factoryCache.insert(make_pair(typeId, entry)).first;
+    }
+
     //
     // Try to find a factory registered for the specific type.
     //
-    ObjectFactoryPtr userFactory = _servantFactoryManager->find(typeId);
-    if(userFactory)
+    if(p->second.userFactory)
     {
-        v = userFactory->create(typeId);
+        v = p->second.userFactory->create(typeId);
     }
 
     //
@@ -1924,10 +1938,14 @@ IceInternal::BasicStream::EncapsDecoder::newInstance(const string& typeId)
     //
     if(!v)
     {
-        userFactory = _servantFactoryManager->find("");
-        if(userFactory)
+        if(!_defaultFactoryResolved)
         {
-            v = userFactory->create(typeId);
+            _defaultFactory = _servantFactoryManager->find("");
+            _defaultFactoryResolved = true;
+        }
+        if(_defaultFactory)
+        {
+            v = _defaultFactory->create(typeId);
         }
     }
 
@@ -1935,14 +1953,10 @@ IceInternal::BasicStream::EncapsDecoder::newInstance(const string& typeId)
     // Last chance: check the table of static factories (i.e.,
     // automatically generated factories for concrete classes).
     //
-    if(!v)
+    if(!v && p->second.staticFactory)
     {
-        ObjectFactoryPtr of = IceInternal::factoryTable->getObjectFactory(typeId);
-        if(of)
-        {
-            v = of->create(typeId);
-            assert(v);
-        }
+        v = p->second.staticFactory->create(typeId);
+        assert(v);
     }
 
     return v;
@@ -1957,6 +1971,12 @@ IceInternal::BasicStream::EncapsDecoder::addPatchEntry(Int index, PatchFunc patc
     // Check if already un-marshalled the object. If that's the case,
     // just patch the object smart pointer and we're done.
     //
+    if(index >= _firstIndex && static_cast<size_t>(index - _firstIndex) < _unmarshaledList.size())
+    {
+        (*patchFunc)(patchAddr, _unmarshaledList[static_cast<size_t>(index - _firstIndex)]);
+        return;
+    }
+
     IndexToPtrMap::iterator p = _unmarshaledMap.find(index);
     if(p != _unmarshaledMap.end())
     {
@@ -1995,8 +2015,20 @@ IceInternal::BasicStream::EncapsDecoder::unmarshal(Int index, const Ice::ObjectP
     //
     // Add the object to the map of un-marshalled objects, this must
     // be done before reading the objects (for circular references).
+    // Encoders allocate indexes sequentially from _firstIndex (1 with
+    // the 1.0 encoding, 2 with the 1.1 encoding where 1 denotes an
+    // inline instance), so the map is only used for indexes that
+    // arrive out of sequence.
     //
-    _unmarshaledMap.insert(make_pair(index, v));
+    if(_unmarshaledMap.empty() && index >= _firstIndex &&
+       static_cast<size_t>(index - _firstIndex) == _unmarshaledList.size())
+    {
+        _unmarshaledList.push_back(v);
+    }
+    else if(index < _firstIndex || static_cast<size_t>(index - _firstIndex) >= _unmarshaledList.size())
+    {
+        _unmarshaledMap.insert(make_pair(index, v));
+    }
 
     //
     // Read the object.
@@ -236,12 +236,12 @@ CollocatedRequestHandler::invokeRequest(OutgoingBase* out, int batchRequestNum)
         // Don't invoke from the user thread, invocation timeouts wouldn't work otherwise.
         _adapter->getThreadPool()->dispatch(new InvokeAll(out, out->os(), this, requestId, batchRequestNum));
     }
-    else if(_dispatcher)
+    else if(_dispatcher && !isInlineDispatch(out->os(), batchRequestNum))
     {
         _adapter->getThreadPool()->dispatchFromThisThread(new InvokeAll(out, out->os(), this, requestId,
                                                                         batchRequestNum));
     }
-    else // Optimization: directly call invokeAll if there's no dispatcher.
+    else // Optimization: directly call invokeAll if there's no dispatcher or if the request is dispatched inline.
     {
         out->sent();
         invokeAll(out->os(), requestId, batchRequestNum);
@@ -406,6 +406,17 @@ CollocatedRequestHandler::sentAsync(OutgoingAsyncBase* outAsync)
     return true;
 }
 
+bool
+CollocatedRequestHandler::isInlineDispatch(BasicStream* os, Int batchRequestNum)
+{
+    if(batchRequestNum > 0)
+    {
+        return false;
+    }
+    os->i = os->b.begin() + sizeof(requestHdr);
+    return _adapter->isInlineDispatch(os);
+}
+
 void
 CollocatedRequestHandler::invokeAll(BasicStream* os, Int requestId, Int batchRequestNum)
 {
@@ -71,6 +71,7 @@ public:
 
 private:
 
+    bool isInlineDispatch(BasicStream*, Ice::Int);
     void handleException(Ice::Int, const Ice::Exception&, bool);
 
     const Ice::ObjectAdapterIPtr _adapter;
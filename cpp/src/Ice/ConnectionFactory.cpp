@@ -17,6 +17,7 @@
 #include <Ice/Transceiver.h>
 #include <Ice/Connector.h>
 #include <Ice/Acceptor.h>
+#include <Ice/WSTransceiver.h>
 #include <Ice/ThreadPool.h>
 #include <Ice/ObjectAdapterI.h> // For getThreadPool().
 #include <Ice/Reference.h>
@@ -310,6 +311,8 @@ IceInternal::OutgoingConnectionFactory::OutgoingConnectionFactory(const Communic
     _communicator(communicator),
     _instance(instance),
     _monitor(new FactoryACMMonitor(instance, instance->clientACM())),
+    _parallelConnectDelay(IceUtil::Time::milliSeconds(
+        instance->initializationData().properties->getPropertyAsInt("Ice.ParallelConnectDelay"))),
     _destroyed(false),
     _pendingConnectCount(0)
 {
@@ -345,15 +348,26 @@ IceInternal::OutgoingConnectionFactory::applyOverrides(const vector<EndpointIPtr
 ConnectionIPtr
 IceInternal::OutgoingConnectionFactory::findConnection(const vector<EndpointIPtr>& endpoints, bool& compress)
 {
+    DefaultsAndOverridesPtr defaultsAndOverrides = _instance->defaultsAndOverrides();
+    assert(!endpoints.empty());
+
+    //
+    // Compute the lookup keys before acquiring the mutex.
+    //
+    vector<EndpointKey> keys;
+    keys.reserve(endpoints.size());
+    for(vector<EndpointIPtr>::const_iterator p = endpoints.begin(); p != endpoints.end(); ++p)
+    {
+        keys.push_back(EndpointKey((*p)->hash(), *p));
+    }
+
     IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
     if(_destroyed)
     {
         throw CommunicatorDestroyedException(__FILE__, __LINE__);
     }
 
-    DefaultsAndOverridesPtr defaultsAndOverrides = _instance->defaultsAndOverrides();
-    assert(!endpoints.empty());
-    for(vector<EndpointIPtr>::const_iterator p = endpoints.begin(); p != endpoints.end(); ++p)
+    for(vector<EndpointKey>::const_iterator p = keys.begin(); p != keys.end(); ++p)
     {
         ConnectionIPtr connection = find(_connectionsByEndpoint, *p, Ice::constMemFun(&ConnectionI::isActiveOrHolding));
         if(connection)
@@ -364,7 +378,7 @@ IceInternal::OutgoingConnectionFactory::findConnection(const vector<EndpointIPtr
             }
             else
             {
-                compress = (*p)->compress();
+                compress = p->second->compress();
             }
             return connection;
         }
@@ -454,8 +468,10 @@ IceInternal::OutgoingConnectionFactory::getConnection(const vector<ConnectorInfo
         for(vector<Ice::ConnectionIPtr>::const_iterator p = cons.begin(); p != cons.end(); ++p)
         {
             remove(_connections, (*p)->connector(), *p);
-            remove(_connectionsByEndpoint, (*p)->endpoint(), *p);
-            remove(_connectionsByEndpoint, (*p)->endpoint()->compress(true), *p);
+            EndpointIPtr endpoint = (*p)->endpoint();
+            remove(_connectionsByEndpoint, EndpointKey(endpoint->hash(), endpoint), *p);
+            endpoint = endpoint->compress(true);
+            remove(_connectionsByEndpoint, EndpointKey(endpoint->hash(), endpoint), *p);
         }
 
         //
@@ -562,9 +578,10 @@ IceInternal::OutgoingConnectionFactory::createConnection(const TransceiverPtr& t
     }
 
     _connections.insert(pair<const ConnectorPtr, ConnectionIPtr>(ci.connector, connection));
-    _connectionsByEndpoint.insert(pair<const EndpointIPtr, ConnectionIPtr>(connection->endpoint(), connection));
-    _connectionsByEndpoint.insert(pair<const EndpointIPtr, ConnectionIPtr>(connection->endpoint()->compress(true),
-                                                                           connection));
+    EndpointIPtr endpoint = connection->endpoint();
+    _connectionsByEndpoint.insert(make_pair(EndpointKey(endpoint->hash(), endpoint), connection));
+    endpoint = endpoint->compress(true);
+    _connectionsByEndpoint.insert(make_pair(EndpointKey(endpoint->hash(), endpoint), connection));
     return connection;
 }
 
@@ -810,7 +827,8 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::ConnectCallback(const I
     _endpoints(endpoints),
     _hasMore(hasMore),
     _callback(cb),
-    _selType(selType)
+    _selType(selType),
+    _attemptsDone(false)
 {
     _endpointsIter = _endpoints.begin();
 }
@@ -979,6 +997,18 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::getConnection()
 void
 IceInternal::OutgoingConnectionFactory::ConnectCallback::nextConnector()
 {
+    //
+    // If parallel connection establishment is enabled, the connectors are
+    // raced rather than tried one after the other: a new attempt is started
+    // each time the delay expires or an attempt fails, and the first
+    // attempt to succeed wins.
+    //
+    if(_iter == _connectors.begin() && _connectors.size() > 1 && _factory->_parallelConnectDelay > IceUtil::Time())
+    {
+        startAttempt();
+        return;
+    }
+
     Ice::ConnectionIPtr connection;
     try
     {
@@ -1071,6 +1101,209 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::operator<(const Connect
     return this < &rhs;
 }
 
+void
+IceInternal::OutgoingConnectionFactory::ConnectCallback::runTimerTask()
+{
+    //
+    // The last attempt didn't complete within the parallel connect
+    // delay, start an attempt with the next connector.
+    //
+    startAttempt();
+}
+
+void
+IceInternal::OutgoingConnectionFactory::ConnectCallback::startAttempt()
+{
+    ConnectAttemptPtr attempt;
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        if(_attemptsDone || _iter == _connectors.end())
+        {
+            return;
+        }
+
+        attempt = new ConnectAttempt(this, *_iter);
+        _attempts.push_back(attempt);
+
+        _instance->timer()->cancel(this);
+        if(++_iter != _connectors.end())
+        {
+            try
+            {
+                _instance->timer()->schedule(this, _factory->_parallelConnectDelay);
+            }
+            catch(const IceUtil::Exception&)
+            {
+                // Ignore, the timer is destroyed. The remaining connectors are tried if this attempt fails.
+            }
+        }
+    }
+
+    const CommunicatorObserverPtr& obsv = _instance->initializationData().observer;
+    if(obsv)
+    {
+        attempt->observer = obsv->getConnectionEstablishmentObserver(attempt->connector.endpoint,
+                                                                     attempt->connector.connector->toString());
+        if(attempt->observer)
+        {
+            attempt->observer->attach();
+        }
+    }
+
+    Ice::ConnectionIPtr connection;
+    try
+    {
+        if(_instance->traceLevels()->network >= 2)
+        {
+            Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
+            out << "trying to establish " << attempt->connector.endpoint->protocol() << " connection to "
+                << attempt->connector.connector->toString();
+        }
+        connection = _factory->createConnection(attempt->connector.connector->connect(), attempt->connector);
+        {
+            IceUtil::Mutex::Lock sync(_mutex);
+            attempt->connection = connection;
+        }
+        connection->start(attempt);
+    }
+    catch(const Ice::LocalException& ex)
+    {
+        if(_instance->traceLevels()->network >= 2)
+        {
+            Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
+            out << "failed to establish " << attempt->connector.endpoint->protocol() << " connection to "
+                << attempt->connector.connector->toString() << "\n" << ex;
+        }
+        attemptFailed(attempt, ex);
+    }
+}
+
+void
+IceInternal::OutgoingConnectionFactory::ConnectCallback::attemptCompleted(const ConnectAttemptPtr& attempt,
+                                                                          const ConnectionIPtr& connection)
+{
+    if(attempt->observer)
+    {
+        attempt->observer->detach();
+    }
+
+    bool won = false;
+    vector<ConnectionIPtr> losers;
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        _attempts.erase(remove(_attempts.begin(), _attempts.end(), attempt), _attempts.end());
+        if(!_attemptsDone)
+        {
+            won = true;
+            _attemptsDone = true;
+            for(vector<ConnectAttemptPtr>::const_iterator p = _attempts.begin(); p != _attempts.end(); ++p)
+            {
+                if((*p)->connection)
+                {
+                    losers.push_back((*p)->connection);
+                }
+            }
+        }
+    }
+
+    if(!won)
+    {
+        //
+        // Another attempt already won the race, this connection isn't needed.
+        //
+        connection->close(false);
+        return;
+    }
+
+    //
+    // Abort the attempts still in progress, they will be reported as failed
+    // and ignored.
+    //
+    _instance->timer()->cancel(this);
+    for(vector<ConnectionIPtr>::const_iterator p = losers.begin(); p != losers.end(); ++p)
+    {
+        (*p)->close(true);
+    }
+
+    connection->activate();
+    _factory->finishGetConnection(_connectors, attempt->connector, connection, this);
+}
+
+void
+IceInternal::OutgoingConnectionFactory::ConnectCallback::attemptFailed(const ConnectAttemptPtr& attempt,
+                                                                       const LocalException& ex)
+{
+    if(attempt->observer)
+    {
+        attempt->observer->failed(ex.ice_name());
+        attempt->observer->detach();
+    }
+
+    bool finished = false;
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        _attempts.erase(remove(_attempts.begin(), _attempts.end(), attempt), _attempts.end());
+        if(_attemptsDone)
+        {
+            return; // Aborted because another attempt won the race.
+        }
+
+        if(dynamic_cast<const Ice::CommunicatorDestroyedException*>(&ex)) // No need to continue.
+        {
+            _iter = _connectors.end();
+        }
+
+        if(_iter == _connectors.end() && _attempts.empty())
+        {
+            _attemptsDone = true;
+            finished = true;
+        }
+    }
+
+    _factory->handleConnectionException(ex, _hasMore || !finished);
+    if(finished)
+    {
+        _instance->timer()->cancel(this);
+        _factory->finishGetConnection(_connectors, ex, this);
+    }
+    else
+    {
+        //
+        // Don't wait for the delay to expire, start the next attempt right
+        // away. This is a no-op if all the connectors are already being
+        // tried and we're waiting for the remaining attempts to complete.
+        //
+        startAttempt();
+    }
+}
+
+IceInternal::OutgoingConnectionFactory::ConnectCallback::ConnectAttempt::ConnectAttempt(
+    const IceUtil::Handle<ConnectCallback>& cb, const ConnectorInfo& ci) :
+    callback(cb),
+    connector(ci)
+{
+}
+
+void
+IceInternal::OutgoingConnectionFactory::ConnectCallback::ConnectAttempt::connectionStartCompleted(
+    const ConnectionIPtr& conn)
+{
+    callback->attemptCompleted(this, conn);
+}
+
+void
+IceInternal::OutgoingConnectionFactory::ConnectCallback::ConnectAttempt::connectionStartFailed(
+    const ConnectionIPtr&, const LocalException& ex)
+{
+    callback->attemptFailed(this, ex);
+}
+
+bool
+IceInternal::OutgoingConnectionFactory::ConnectCallback::ConnectAttempt::operator==(const ConnectAttempt& rhs) const
+{
+    return this == &rhs;
+}
+
 void
 IceInternal::IncomingConnectionFactory::activate()
 {
@@ -1303,6 +1536,16 @@ IceInternal::IncomingConnectionFactory::message(ThreadPoolCurrent& current)
         {
             transceiver = _acceptor->accept();
 
+            //
+            // Plain HTTP requests received on WebSocket endpoints are
+            // served by the adapter's HTTP request handler, if any.
+            //
+            WSTransceiverPtr ws = WSTransceiverPtr::dynamicCast(transceiver);
+            if(ws)
+            {
+                ws->setHttpRequestHandler(_adapter->getHttpRequestHandler());
+            }
+
             if(_instance->traceLevels()->network >= 2)
             {
                 Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
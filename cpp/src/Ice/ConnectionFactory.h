@@ -12,6 +12,7 @@
 
 #include <IceUtil/Mutex.h>
 #include <IceUtil/Monitor.h>
+#include <IceUtil/Timer.h>
 #include <Ice/CommunicatorF.h>
 #include <Ice/ConnectionFactoryF.h>
 #include <Ice/ConnectionI.h>
@@ -86,7 +87,8 @@ private:
         EndpointIPtr endpoint;
     };
 
-    class ConnectCallback : public Ice::ConnectionI::StartCallback, public IceInternal::EndpointI_connectors
+    class ConnectCallback : public Ice::ConnectionI::StartCallback, public IceInternal::EndpointI_connectors,
+                            public IceUtil::TimerTask
     {
     public:
 
@@ -114,8 +116,37 @@ private:
 
         bool operator<(const ConnectCallback&) const;
 
+        virtual void runTimerTask();
+
     private:
 
+        //
+        // An attempt to connect to one of the connectors when connectors
+        // are raced with Ice.ParallelConnectDelay.
+        //
+        class ConnectAttempt : public Ice::ConnectionI::StartCallback
+        {
+        public:
+
+            ConnectAttempt(const IceUtil::Handle<ConnectCallback>&, const ConnectorInfo&);
+
+            virtual void connectionStartCompleted(const Ice::ConnectionIPtr&);
+            virtual void connectionStartFailed(const Ice::ConnectionIPtr&, const Ice::LocalException&);
+
+            bool operator==(const ConnectAttempt&) const;
+
+            const IceUtil::Handle<ConnectCallback> callback;
+            const ConnectorInfo connector;
+            Ice::ConnectionIPtr connection;
+            Ice::Instrumentation::ObserverPtr observer;
+        };
+        typedef IceUtil::Handle<ConnectAttempt> ConnectAttemptPtr;
+        friend class ConnectAttempt;
+
+        void startAttempt();
+        void attemptCompleted(const ConnectAttemptPtr&, const Ice::ConnectionIPtr&);
+        void attemptFailed(const ConnectAttemptPtr&, const Ice::LocalException&);
+
         const InstancePtr _instance;
         const OutgoingConnectionFactoryPtr _factory;
         const std::vector<EndpointIPtr> _endpoints;
@@ -126,6 +157,10 @@ private:
         std::vector<EndpointIPtr>::const_iterator _endpointsIter;
         std::vector<ConnectorInfo> _connectors;
         std::vector<ConnectorInfo>::const_iterator _iter;
+
+        IceUtil::Mutex _mutex; // Protects the attempt state below.
+        std::vector<ConnectAttemptPtr> _attempts;
+        bool _attemptsDone;
     };
     typedef IceUtil::Handle<ConnectCallback> ConnectCallbackPtr;
     friend class ConnectCallback;
@@ -151,12 +186,19 @@ private:
     Ice::CommunicatorPtr _communicator;
     const InstancePtr _instance;
     const FactoryACMMonitorPtr _monitor;
+    const IceUtil::Time _parallelConnectDelay;
     bool _destroyed;
 
     std::multimap<ConnectorPtr, Ice::ConnectionIPtr> _connections;
     std::map<ConnectorPtr, std::set<ConnectCallbackPtr> > _pending;
 
-    std::multimap<EndpointIPtr, Ice::ConnectionIPtr> _connectionsByEndpoint;
+    //
+    // Connections are indexed by the endpoint hash value first, so that
+    // looking up an endpoint only needs a full endpoint comparison with
+    // the endpoints that have the same hash value.
+    //
+    typedef std::pair<Ice::Int, EndpointIPtr> EndpointKey;
+    std::multimap<EndpointKey, Ice::ConnectionIPtr> _connectionsByEndpoint;
     int _pendingConnectCount;
 };
 
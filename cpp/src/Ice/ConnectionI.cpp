@@ -45,6 +45,20 @@ namespace
 
 const ::std::string __flushBatchRequests_name = "flushBatchRequests";
 
+//
+// Messages larger than this are read in chunks, the read buffer grows as
+// the message data arrives.
+//
+const Int readChunkSize = 256 * 1024;
+
+//
+// Replies smaller than this are coalesced when reply coalescing is
+// enabled, the coalesced replies are sent once they reach the flush
+// size.
+//
+const size_t coalesceReplySizeMax = 1024;
+const size_t coalesceFlushSize = 16 * 1024;
+
 
 class TimeoutCallback : public IceUtil::TimerTask
 {
@@ -65,6 +79,25 @@ private:
     Ice::ConnectionI* _connection;
 };
 
+class FlushRepliesCallback : public IceUtil::TimerTask
+{
+public:
+
+    FlushRepliesCallback(const ConnectionIPtr& connection) : _connection(connection)
+    {
+    }
+
+    void
+    runTimerTask()
+    {
+        _connection->flushReplies();
+    }
+
+private:
+
+    const ConnectionIPtr _connection;
+};
+
 class DispatchCall : public DispatchWorkItem
 {
 public:
@@ -1197,8 +1230,54 @@ Ice::ConnectionI::sendResponse(Int, BasicStream* os, Byte compressFlag, bool /*a
             _exception->ice_throw();
         }
 
-        OutgoingMessage message(os, compressFlag > 0);
-        sendMessage(message);
+        if(_coalesceWindow != IceUtil::Time() && compressFlag == 0 && os->b.size() < coalesceReplySizeMax &&
+           (_dispatchCount > 0 || !_replies.b.empty()))
+        {
+            //
+            // Other requests from this connection are being dispatched,
+            // coalesce the reply with theirs to send the replies with a
+            // single write. The coalesced replies are sent once the
+            // last dispatch completes, once they reach the flush size or
+            // once the coalesce window expires, whichever comes first.
+            //
+            Int sz = static_cast<Int>(os->b.size());
+            const Byte* p = reinterpret_cast<const Byte*>(&sz);
+#ifdef ICE_BIG_ENDIAN
+            reverse_copy(p, p + sizeof(Int), os->b.begin() + 10);
+#else
+            copy(p, p + sizeof(Int), os->b.begin() + 10);
+#endif
+            traceSend(*os, _logger, _traceLevels);
+            _replies.writeBlob(os->b.begin(), os->b.size());
+
+            if(_dispatchCount == 0 || _replies.b.size() >= coalesceFlushSize)
+            {
+                sendReplies();
+            }
+            else if(!_flushRepliesScheduled)
+            {
+                try
+                {
+                    _timer->schedule(new FlushRepliesCallback(this), _coalesceWindow);
+                    _flushRepliesScheduled = true;
+                }
+                catch(const IceUtil::Exception&)
+                {
+                    sendReplies(); // The timer is destroyed.
+                }
+            }
+        }
+        else
+        {
+            //
+            // Send the coalesced replies first to preserve the order of
+            // the replies, an isolated reply is sent immediately.
+            //
+            sendReplies();
+
+            OutgoingMessage message(os, compressFlag > 0);
+            sendMessage(message);
+        }
 
         if(_state == StateClosing && _dispatchCount == 0)
         {
@@ -1236,6 +1315,11 @@ Ice::ConnectionI::sendNoResponse()
             _exception->ice_throw();
         }
 
+        if(_dispatchCount == 0)
+        {
+            sendReplies();
+        }
+
         if(_state == StateClosing && _dispatchCount == 0)
         {
             initiateShutdown();
@@ -1574,8 +1658,27 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
                     }
                     if(size > static_cast<Int>(_readStream.b.size()))
                     {
-                        _readStream.b.resize(size);
+                        //
+                        // Don't allocate the whole buffer upfront for large messages
+                        // received over a stream transport, the buffer is grown as
+                        // data is received to not hold memory for data that might
+                        // never arrive.
+                        //
+                        _readStream.b.resize(_endpoint->datagram() ? size : min(size, max(readChunkSize,
+                                                                                         static_cast<Int>(pos))));
                     }
+                    _readMessageSize = size;
+                    _readStream.i = _readStream.b.begin() + pos;
+                }
+                else if(_readStream.i == _readStream.b.end() &&
+                        static_cast<Int>(_readStream.b.size()) < _readMessageSize)
+                {
+                    //
+                    // Grow the buffer for the next chunk of the message. The
+                    // buffer size is doubled to amortize the reallocation cost.
+                    //
+                    ptrdiff_t pos = _readStream.i - _readStream.b.begin();
+                    _readStream.b.resize(min(static_cast<size_t>(_readMessageSize), 2 * _readStream.b.size()));
                     _readStream.i = _readStream.b.begin() + pos;
                 }
 
@@ -1720,7 +1823,15 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
         }
     }
 
-    if(!_dispatcher) // Optimization, call dispatch() directly if there's no dispatcher.
+    //
+    // Optimization, call dispatch() directly if there's no dispatcher. A
+    // single request is also dispatched directly if the object adapter is
+    // configured to dispatch its operation inline (<adapter>.InlineDispatch),
+    // unless there are other callbacks which must go through the dispatcher.
+    //
+    if(!_dispatcher ||
+       (invokeNum == 1 && !startCB && sentCBs.empty() && !outAsync && !heartbeatCallback &&
+        adapter && static_cast<ObjectAdapterI*>(adapter.get())->isInlineDispatch(&current.stream)))
     {
         dispatch(startCB, sentCBs, compress, requestId, invokeNum, servantManager, adapter, outAsync, heartbeatCallback,
                  current.stream);
@@ -1831,6 +1942,18 @@ ConnectionI::dispatch(const StartCallbackPtr& startCB, const vector<OutgoingMess
         _dispatchCount -= dispatchedCount;
         if(_dispatchCount == 0)
         {
+            if(!_replies.b.empty())
+            {
+                try
+                {
+                    sendReplies();
+                }
+                catch(const LocalException& ex)
+                {
+                    setState(StateClosed, ex);
+                }
+            }
+
             //
             // Only initiate shutdown if not already done. It might
             // have already been done if the sent callback or AMI
@@ -2053,6 +2176,21 @@ Ice::ConnectionI::timedOut()
     }
 }
 
+void
+Ice::ConnectionI::flushReplies()
+{
+    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+    _flushRepliesScheduled = false;
+    try
+    {
+        sendReplies();
+    }
+    catch(const LocalException& ex)
+    {
+        setState(StateClosed, ex);
+    }
+}
+
 string
 Ice::ConnectionI::type() const
 {
@@ -2129,8 +2267,12 @@ Ice::ConnectionI::ConnectionI(const CommunicatorPtr& communicator,
     _batchRequestQueue(new BatchRequestQueue(instance, endpoint->datagram())),
     _readStream(_instance.get(), Ice::currentProtocolEncoding),
     _readHeader(false),
+    _readMessageSize(0),
     _writeStream(_instance.get(), Ice::currentProtocolEncoding),
     _dispatchCount(0),
+    _coalesceWindow(adapter ? adapter->coalesceReplies() : IceUtil::Time()),
+    _replies(_instance.get(), Ice::currentProtocolEncoding),
+    _flushRepliesScheduled(false),
     _state(StateNotInitialized),
     _shutdownInitiated(false),
     _initialized(false),
@@ -2759,21 +2901,25 @@ Ice::ConnectionI::sendNextMessage(vector<OutgoingMessage>& callbacks)
                 }
 
                 //
-                // No compression, just fill in the message size.
+                // No compression, just fill in the message size. The sizes
+                // of coalesced replies are filled in when they're coalesced.
                 //
-                Int sz = static_cast<Int>(message->stream->b.size());
-                const Byte* p = reinterpret_cast<const Byte*>(&sz);
+                if(!message->coalesced)
+                {
+                    Int sz = static_cast<Int>(message->stream->b.size());
+                    const Byte* p = reinterpret_cast<const Byte*>(&sz);
 #ifdef ICE_BIG_ENDIAN
-                reverse_copy(p, p + sizeof(Int), message->stream->b.begin() + 10);
+                    reverse_copy(p, p + sizeof(Int), message->stream->b.begin() + 10);
 #else
-                copy(p, p + sizeof(Int), message->stream->b.begin() + 10);
+                    copy(p, p + sizeof(Int), message->stream->b.begin() + 10);
 #endif
+                }
                 message->stream->i = message->stream->b.begin();
                 if(message->outAsync)
                 {
                     trace("sending asynchronous request", *message->stream, _logger, _traceLevels);
                 }
-                else
+                else if(!message->coalesced)
                 {
                     traceSend(*message->stream, _logger, _traceLevels);
                 }
@@ -2912,22 +3058,26 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
         }
 
         //
-        // No compression, just fill in the message size.
+        // No compression, just fill in the message size. The sizes of
+        // coalesced replies are filled in when they're coalesced.
         //
-        Int sz = static_cast<Int>(message.stream->b.size());
-        const Byte* p = reinterpret_cast<const Byte*>(&sz);
+        if(!message.coalesced)
+        {
+            Int sz = static_cast<Int>(message.stream->b.size());
+            const Byte* p = reinterpret_cast<const Byte*>(&sz);
 #ifdef ICE_BIG_ENDIAN
-        reverse_copy(p, p + sizeof(Int), message.stream->b.begin() + 10);
+            reverse_copy(p, p + sizeof(Int), message.stream->b.begin() + 10);
 #else
-        copy(p, p + sizeof(Int), message.stream->b.begin() + 10);
+            copy(p, p + sizeof(Int), message.stream->b.begin() + 10);
 #endif
+        }
         message.stream->i = message.stream->b.begin();
 
         if(message.outAsync)
         {
             trace("sending asynchronous request", *message.stream, _logger, _traceLevels);
         }
-        else
+        else if(!message.coalesced)
         {
             traceSend(*message.stream, _logger, _traceLevels);
         }
@@ -2970,6 +3120,30 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
     return AsyncStatusQueued;
 }
 
+void
+Ice::ConnectionI::sendReplies()
+{
+    if(_replies.b.empty())
+    {
+        return;
+    }
+
+    if(_state >= StateClosed)
+    {
+        _replies.b.clear(); // The replies can't be sent anymore.
+        return;
+    }
+
+    OutgoingMessage message(&_replies, false);
+    message.coalesced = true;
+    sendMessage(message);
+
+    //
+    // The replies are either sent or adopted by the queued message.
+    //
+    _replies.b.reset();
+}
+
 #ifdef ICE_HAS_BZIP2
 static string
 getBZ2Error(int bzError)
@@ -92,7 +92,7 @@ public:
     struct OutgoingMessage
     {
         OutgoingMessage(IceInternal::BasicStream* str, bool comp) :
-            stream(str), out(0), compress(comp), requestId(0), adopted(false)
+            stream(str), out(0), compress(comp), requestId(0), adopted(false), coalesced(false)
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_WINRT)
             , isSent(false), invokeSent(false), receivedReply(false)
 #endif
@@ -100,7 +100,7 @@ public:
         }
 
         OutgoingMessage(IceInternal::OutgoingBase* o, IceInternal::BasicStream* str, bool comp, int rid) :
-            stream(str), out(o), compress(comp), requestId(rid), adopted(false)
+            stream(str), out(o), compress(comp), requestId(rid), adopted(false), coalesced(false)
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_WINRT)
             , isSent(false), invokeSent(false), receivedReply(false)
 #endif
@@ -109,7 +109,7 @@ public:
 
         OutgoingMessage(const IceInternal::OutgoingAsyncBasePtr& o, IceInternal::BasicStream* str,
                         bool comp, int rid) :
-            stream(str), out(0), outAsync(o), compress(comp), requestId(rid), adopted(false)
+            stream(str), out(0), outAsync(o), compress(comp), requestId(rid), adopted(false), coalesced(false)
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_WINRT)
             , isSent(false), invokeSent(false), receivedReply(false)
 #endif
@@ -127,6 +127,7 @@ public:
         bool compress;
         int requestId;
         bool adopted;
+        bool coalesced; // Coalesced replies, the message sizes are already set.
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_WINRT)
         bool isSent;
         bool invokeSent;
@@ -221,6 +222,7 @@ public:
     virtual IceInternal::NativeInfoPtr getNativeInfo();
 
     void timedOut();
+    void flushReplies();
 
     virtual std::string type() const; // From Connection.
     virtual Ice::Int timeout() const; // From Connection.
@@ -270,6 +272,7 @@ private:
     bool validate(IceInternal::SocketOperation = IceInternal::SocketOperationNone);
     IceInternal::SocketOperation sendNextMessage(std::vector<OutgoingMessage>&);
     IceInternal::AsyncStatus sendMessage(OutgoingMessage&);
+    void sendReplies();
 
 #ifdef ICE_HAS_BZIP2
     void doCompress(IceInternal::BasicStream&, IceInternal::BasicStream&);
@@ -347,12 +350,17 @@ private:
 
     IceInternal::BasicStream _readStream;
     bool _readHeader;
+    Ice::Int _readMessageSize;
     IceInternal::BasicStream _writeStream;
 
     Observer _observer;
 
     int _dispatchCount;
 
+    const IceUtil::Time _coalesceWindow;
+    IceInternal::BasicStream _replies;
+    bool _flushRepliesScheduled;
+
     State _state; // The current state.
     bool _shutdownInitiated;
     bool _initialized;
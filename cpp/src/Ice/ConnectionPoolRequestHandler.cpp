@@ -0,0 +1,122 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/ConnectionPoolRequestHandler.h>
+#include <Ice/Reference.h>
+#include <Ice/ConnectionI.h>
+#include <Ice/OutgoingAsync.h>
+
+using namespace std;
+using namespace IceInternal;
+
+ConnectionPoolRequestHandler::ConnectionPoolRequestHandler(const ReferencePtr& reference,
+                                                           const vector<RequestHandlerPtr>& handlers) :
+    RequestHandler(reference),
+    _handlers(handlers),
+    _next(0)
+{
+    assert(!_handlers.empty());
+}
+
+RequestHandlerPtr
+ConnectionPoolRequestHandler::update(const RequestHandlerPtr& previousHandler, const RequestHandlerPtr& newHandler)
+{
+    if(previousHandler.get() == this)
+    {
+        return newHandler;
+    }
+
+    Lock sync(*this);
+    for(vector<RequestHandlerPtr>::iterator p = _handlers.begin(); p != _handlers.end(); ++p)
+    {
+        RequestHandlerPtr handler = (*p)->update(previousHandler, newHandler);
+        if(!handler)
+        {
+            //
+            // One of the pooled handlers is cleared, clear the pool as well
+            // to get it re-created on the next invocation.
+            //
+            return 0;
+        }
+        *p = handler;
+    }
+    return this;
+}
+
+RequestHandlerPtr
+ConnectionPoolRequestHandler::select()
+{
+    Lock sync(*this);
+    RequestHandlerPtr handler = _handlers[_next];
+    _next = (_next + 1) % _handlers.size();
+    return handler;
+}
+
+bool
+ConnectionPoolRequestHandler::sendRequest(ProxyOutgoingBase* out)
+{
+    //
+    // Invocations are sent through the pooled handler returned by
+    // select(), which is also the handler used to cancel them. Requests
+    // sent through the pool itself always use the first pooled handler,
+    // requestCanceled() cancels them with the same handler.
+    //
+    return first()->sendRequest(out);
+}
+
+AsyncStatus
+ConnectionPoolRequestHandler::sendAsyncRequest(const ProxyOutgoingAsyncBasePtr& out)
+{
+    //
+    // Only begin_ice_getConnection sends through the pool, it always
+    // uses the first pooled handler.
+    //
+    return first()->sendAsyncRequest(out);
+}
+
+void
+ConnectionPoolRequestHandler::requestCanceled(OutgoingBase* out, const Ice::LocalException& ex)
+{
+    first()->requestCanceled(out, ex);
+}
+
+void
+ConnectionPoolRequestHandler::asyncRequestCanceled(const OutgoingAsyncBasePtr& out, const Ice::LocalException& ex)
+{
+    first()->asyncRequestCanceled(out, ex);
+}
+
+Ice::ConnectionIPtr
+ConnectionPoolRequestHandler::getConnection()
+{
+    //
+    // Don't rotate, the proxy's connection is the connection of the
+    // first pooled handler.
+    //
+    return first()->getConnection();
+}
+
+Ice::ConnectionIPtr
+ConnectionPoolRequestHandler::waitForConnection()
+{
+    //
+    // Only wait for the connection of the first handler, it's the
+    // proxy's connection. The other pooled connections are established
+    // in the background and their failures are reported to the
+    // invocations that select them.
+    //
+    return first()->waitForConnection();
+}
+
+RequestHandlerPtr
+ConnectionPoolRequestHandler::first()
+{
+    Lock sync(*this);
+    return _handlers.front();
+}
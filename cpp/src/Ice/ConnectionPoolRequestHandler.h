@@ -0,0 +1,56 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_CONNECTION_POOL_REQUEST_HANDLER_H
+#define ICE_CONNECTION_POOL_REQUEST_HANDLER_H
+
+#include <IceUtil/Mutex.h>
+#include <Ice/RequestHandler.h>
+#include <Ice/ReferenceF.h>
+
+#include <vector>
+
+namespace IceInternal
+{
+
+//
+// Spreads the requests of a proxy over several connections to the
+// same endpoints, see Ice.ConnectionPoolSize. Each pooled handler
+// uses a different connection ID and is replaced independently when
+// its connection is established.
+//
+class ConnectionPoolRequestHandler : public RequestHandler, private IceUtil::Mutex
+{
+public:
+
+    ConnectionPoolRequestHandler(const ReferencePtr&, const std::vector<RequestHandlerPtr>&);
+
+    virtual RequestHandlerPtr update(const RequestHandlerPtr&, const RequestHandlerPtr&);
+    virtual RequestHandlerPtr select();
+
+    virtual bool sendRequest(ProxyOutgoingBase*);
+    virtual AsyncStatus sendAsyncRequest(const ProxyOutgoingAsyncBasePtr&);
+
+    virtual void requestCanceled(OutgoingBase*, const Ice::LocalException&);
+    virtual void asyncRequestCanceled(const OutgoingAsyncBasePtr&, const Ice::LocalException&);
+
+    virtual Ice::ConnectionIPtr getConnection();
+    virtual Ice::ConnectionIPtr waitForConnection();
+
+private:
+
+    RequestHandlerPtr first();
+
+    std::vector<RequestHandlerPtr> _handlers;
+    size_t _next;
+};
+
+}
+
+#endif
@@ -117,6 +117,19 @@ private:
 };
 typedef IceUtil::Handle<HttpParser> HttpParserPtr;
 
+//
+// Handler for plain HTTP requests received on a WebSocket endpoint
+// that don't ask for a protocol upgrade. The handler returns false if
+// it doesn't know the requested resource.
+//
+class HttpRequestHandler : public IceUtil::Shared
+{
+public:
+
+    virtual bool handleRequest(const HttpParser&, std::string&, std::string&) = 0;
+};
+typedef IceUtil::Handle<HttpRequestHandler> HttpRequestHandlerPtr;
+
 }
 
 #endif
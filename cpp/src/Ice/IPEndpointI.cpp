@@ -503,6 +503,10 @@ IceInternal::EndpointHostResolver::EndpointHostResolver(const InstancePtr& insta
     _instance(instance),
     _protocol(instance->protocolSupport()),
     _preferIPv6(instance->preferIPv6()),
+    _cacheTimeout(IceUtil::Time::seconds(
+        instance->initializationData().properties->getPropertyAsInt("Ice.HostResolver.CacheTimeout"))),
+    _negativeCacheTimeout(IceUtil::Time::seconds(
+        instance->initializationData().properties->getPropertyAsInt("Ice.HostResolver.NegativeCacheTimeout"))),
     _destroyed(false)
 {
     __setNoDelete(true);
@@ -536,8 +540,10 @@ IceInternal::EndpointHostResolver::resolve(const string& host, int port, Ice::En
                                            const IPEndpointIPtr& endpoint, const EndpointI_connectorsPtr& callback)
 {
     //
-    // Try to get the addresses without DNS lookup. If this doesn't work, we queue a resolve
-    // entry and the thread will take care of getting the endpoint addresses.
+    // Try to get the addresses without DNS lookup, either because the host is a
+    // numeric address or because the result of a previous lookup is cached. If
+    // this doesn't work, we queue a resolve entry and the thread will take care
+    // of getting the endpoint addresses.
     //
     NetworkProxyPtr networkProxy = _instance->networkProxy();
     if(!networkProxy)
@@ -545,6 +551,11 @@ IceInternal::EndpointHostResolver::resolve(const string& host, int port, Ice::En
         try
         {
             vector<Address> addrs = getAddresses(host, port, _protocol, selType, _preferIPv6, false);
+            if(addrs.empty())
+            {
+                Lock sync(*this);
+                findCachedAddresses(host, port, selType, addrs);
+            }
             if(!addrs.empty())
             {
                 callback->connectors(endpoint->connectors(addrs, 0));
@@ -633,13 +644,43 @@ IceInternal::EndpointHostResolver::run()
                 }
             }
 
-            r.callback->connectors(r.endpoint->connectors(getAddresses(r.host,
-                                                                       r.port,
-                                                                       protocol,
-                                                                       r.selType,
-                                                                       _preferIPv6,
-                                                                       true),
-                                                          networkProxy));
+            //
+            // Several entries for the same host may have been queued before the
+            // first lookup completed, check the cache again before resolving.
+            //
+            vector<Address> addrs;
+            bool cached = false;
+            if(!networkProxy)
+            {
+                Lock sync(*this);
+                cached = findCachedAddresses(r.host, r.port, r.selType, addrs);
+            }
+
+            if(!cached)
+            {
+                try
+                {
+                    addrs = getAddresses(r.host, r.port, protocol, Ice::Ordered, _preferIPv6, true);
+                }
+                catch(const Ice::DNSException& ex)
+                {
+                    if(!networkProxy)
+                    {
+                        Lock sync(*this);
+                        cacheAddresses(r.host, r.port, vector<Address>(), ex.error);
+                    }
+                    throw;
+                }
+
+                if(!networkProxy)
+                {
+                    Lock sync(*this);
+                    cacheAddresses(r.host, r.port, addrs, 0);
+                }
+                sortAddresses(addrs, protocol, r.selType, _preferIPv6);
+            }
+
+            r.callback->connectors(r.endpoint->connectors(addrs, networkProxy));
 
             if(threadObserver)
             {
@@ -695,6 +736,79 @@ IceInternal::EndpointHostResolver::updateObserver()
     }
 }
 
+bool
+IceInternal::EndpointHostResolver::findCachedAddresses(const string& host, int port, Ice::EndpointSelectionType selType,
+                                                       vector<Address>& addrs)
+{
+    //
+    // Must be called with the mutex locked.
+    //
+    Cache::iterator p = _cache.find(make_pair(host, port));
+    if(p == _cache.end())
+    {
+        return false;
+    }
+
+    if(p->second.expiration <= IceUtil::Time::now(IceUtil::Time::Monotonic))
+    {
+        _cache.erase(p);
+        return false;
+    }
+
+    if(p->second.addresses.empty())
+    {
+        Ice::DNSException ex(__FILE__, __LINE__);
+        ex.error = p->second.error;
+        ex.host = host;
+        throw ex;
+    }
+
+    addrs = p->second.addresses;
+    sortAddresses(addrs, _protocol, selType, _preferIPv6);
+    return true;
+}
+
+void
+IceInternal::EndpointHostResolver::cacheAddresses(const string& host, int port, const vector<Address>& addrs, int error)
+{
+    //
+    // Must be called with the mutex locked.
+    //
+    const IceUtil::Time timeout = addrs.empty() ? _negativeCacheTimeout : _cacheTimeout;
+    if(timeout <= IceUtil::Time())
+    {
+        return;
+    }
+
+    IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+
+    //
+    // Expired entries are otherwise only removed when looked up again, so
+    // purge them from time to time to keep the cache from growing unbounded
+    // when many different hosts are resolved.
+    //
+    if(_cache.size() >= 1024)
+    {
+        Cache::iterator p = _cache.begin();
+        while(p != _cache.end())
+        {
+            if(p->second.expiration <= now)
+            {
+                _cache.erase(p++);
+            }
+            else
+            {
+                ++p;
+            }
+        }
+    }
+
+    CacheEntry& entry = _cache[make_pair(host, port)];
+    entry.addresses = addrs;
+    entry.error = error;
+    entry.expiration = now + timeout;
+}
+
 #else
 
 IceInternal::EndpointHostResolver::EndpointHostResolver(const InstancePtr& instance) :
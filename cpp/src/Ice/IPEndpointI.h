@@ -21,7 +21,9 @@
 #include <Ice/ObserverHelper.h>
 
 #ifndef ICE_OS_WINRT
+#   include <IceUtil/Time.h>
 #   include <deque>
+#   include <map>
 #endif
 
 namespace IceInternal
@@ -132,11 +134,29 @@ private:
         Ice::Instrumentation::ObserverPtr observer;
     };
 
+    //
+    // Cached result of a host name lookup. The addresses are kept in
+    // the Ordered order, an empty list indicates a failed lookup.
+    //
+    struct CacheEntry
+    {
+        std::vector<Address> addresses;
+        int error;
+        IceUtil::Time expiration;
+    };
+    typedef std::map<std::pair<std::string, int>, CacheEntry> Cache;
+
+    bool findCachedAddresses(const std::string&, int, Ice::EndpointSelectionType, std::vector<Address>&);
+    void cacheAddresses(const std::string&, int, const std::vector<Address>&, int);
+
     const InstancePtr _instance;
     const IceInternal::ProtocolSupport _protocol;
     const bool _preferIPv6;
+    const IceUtil::Time _cacheTimeout;
+    const IceUtil::Time _negativeCacheTimeout;
     bool _destroyed;
     std::deque<ResolveEntry> _queue;
+    Cache _cache;
     ObserverHelperT<Ice::Instrumentation::ThreadObserver> _observer;
 #else
     const InstancePtr _instance;
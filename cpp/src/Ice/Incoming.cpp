@@ -22,6 +22,7 @@
 #include <Ice/Protocol.h>
 #include <Ice/ReplyStatus.h>
 #include <Ice/ResponseHandler.h>
+#include <Ice/Tracer.h>
 #include <IceUtil/StringUtil.h>
 #include <typeinfo>
 
@@ -614,6 +615,13 @@ IceInternal::Incoming::invoke(const ServantManagerPtr& servantManager, BasicStre
         _observer.attach(obsv->getDispatchObserver(_current, static_cast<Int>(_is->i - start + sz)));
     }
 
+    //
+    // If the dispatch is sampled, invocations made by this thread
+    // while dispatching are recorded as child spans of the dispatch.
+    //
+    _observer.startSpan(_is->instance(), _current);
+    Tracer::DispatchScope traceScope(_observer.getSpan());
+
     //
     // Don't put the code above into the try block below. Exceptions
     // in the code above are considered fatal, and must propagate to
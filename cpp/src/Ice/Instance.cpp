@@ -23,6 +23,9 @@
 #include <Ice/ObjectFactoryManager.h>
 #include <Ice/LocalException.h>
 #include <Ice/ObjectAdapterFactory.h>
+#include <Ice/ObjectAdapterI.h>
+#include <Ice/HttpParser.h>
+#include <Ice/MetricsAdminI.h>
 #include <Ice/Exception.h>
 #include <Ice/PropertiesI.h>
 #include <Ice/PropertiesAdminI.h>
@@ -33,6 +36,7 @@
 #include <Ice/WSEndpoint.h>
 #include <Ice/RequestHandlerFactory.h>
 #include <Ice/RetryQueue.h>
+#include <Ice/Tracer.h>
 #include <Ice/DynamicLibrary.h>
 #include <Ice/PluginManagerI.h>
 #include <Ice/Initialize.h>
@@ -167,6 +171,44 @@ Init init;
 //
 IceInternal::RegisterPluginsInit initPlugins;
 
+//
+// Serves the metrics of the Metrics admin facet in the OpenMetrics
+// text format to plain HTTP requests for the configured resource.
+//
+class MetricsHttpRequestHandler : public IceInternal::HttpRequestHandler
+{
+public:
+
+    MetricsHttpRequestHandler(const IceInternal::MetricsAdminIPtr& metrics, const string& resource) :
+        _metrics(metrics), _resource(resource)
+    {
+    }
+
+    virtual bool
+    handleRequest(const IceInternal::HttpParser& parser, string& contentType, string& body)
+    {
+        string uri = parser.uri();
+        string::size_type pos = uri.find('?');
+        if(pos != string::npos)
+        {
+            uri.erase(pos);
+        }
+        if(uri != _resource)
+        {
+            return false;
+        }
+
+        contentType = "application/openmetrics-text; version=1.0.0; charset=utf-8";
+        body = _metrics->getOpenMetrics();
+        return true;
+    }
+
+private:
+
+    const IceInternal::MetricsAdminIPtr _metrics;
+    const string _resource;
+};
+
 }
 
 namespace IceInternal // Required because ObserverUpdaterI is a friend of Instance
@@ -847,6 +889,21 @@ IceInternal::Instance::addAllAdminFacets()
         }
     }
     _adminFacets.swap(filteredFacets);
+
+    //
+    // Serve the metrics over plain HTTP on the WebSocket endpoints of
+    // the admin object adapter if a resource is configured.
+    //
+    const string resource = _initData.properties->getProperty("Ice.Admin.Metrics.HttpResource");
+    if(!resource.empty())
+    {
+        MetricsAdminIPtr metrics = MetricsAdminIPtr::dynamicCast(_adminAdapter->findFacet(_adminIdentity, "Metrics"));
+        ObjectAdapterIPtr adapter = ObjectAdapterIPtr::dynamicCast(_adminAdapter);
+        if(metrics && adapter)
+        {
+            adapter->setHttpRequestHandler(new MetricsHttpRequestHandler(metrics, resource));
+        }
+    }
 }
 
 void
@@ -1359,6 +1416,11 @@ IceInternal::Instance::Instance(const CommunicatorPtr& communicator, const Initi
 
         _retryQueue = new RetryQueue(this);
 
+        if(_initData.properties->getPropertyAsInt("Ice.Tracer.Enabled") > 0)
+        {
+            const_cast<TracerPtr&>(_tracer) = new Tracer(this);
+        }
+
         //
         // When _wstringConverter isn't set, use the default Unicode wstring converter
         //
@@ -1539,6 +1601,15 @@ IceInternal::Instance::finishSetup(int& argc, char* argv[], const Ice::Communica
                 propsAdmin->addUpdateCallback(observer->getFacet());
             }
         }
+
+        //
+        // Tracer facet
+        //
+        const string tracerFacetName = "Tracer";
+        if(_tracer && (_adminFacetFilter.empty() || _adminFacetFilter.find(tracerFacetName) != _adminFacetFilter.end()))
+        {
+            _adminFacets.insert(make_pair(tracerFacetName, new TracerAdminI(_tracer)));
+        }
     }
 
     //
@@ -1572,6 +1643,14 @@ IceInternal::Instance::finishSetup(int& argc, char* argv[], const Ice::Communica
         throw;
     }
 
+    //
+    // Export the spans recorded by the tracer every second.
+    //
+    if(_tracer && _tracer->hasFile())
+    {
+        _timer->scheduleRepeated(_tracer.get(), IceUtil::Time::seconds(1));
+    }
+
     try
     {
         _endpointHostResolver = new EndpointHostResolver(this);
@@ -1794,6 +1873,11 @@ IceInternal::Instance::destroy()
         _endpointFactoryManager->destroy();
     }
 
+    if(_tracer)
+    {
+        _tracer->destroy();
+    }
+
     if(_initData.properties->getPropertyAsInt("Ice.Warn.UnusedProperties") > 0)
     {
         set<string> unusedProperties = static_cast<PropertiesI*>(_initData.properties.get())->getUnusedProperties();
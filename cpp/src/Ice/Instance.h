@@ -33,6 +33,7 @@
 #include <Ice/EndpointFactoryManagerF.h>
 #include <Ice/IPEndpointIF.h>
 #include <Ice/RetryQueueF.h>
+#include <Ice/TracerF.h>
 #include <Ice/DynamicLibraryF.h>
 #include <Ice/PluginF.h>
 #include <Ice/NetworkF.h>
@@ -111,6 +112,7 @@ public:
     size_t messageSizeMax() const { return _messageSizeMax; }
     size_t batchAutoFlushSize() const { return _batchAutoFlushSize; }
     bool collectObjects() const { return _collectObjects; }
+    const TracerPtr& tracer() const { return _tracer; }
     const ACMConfig& clientACM() const;
     const ACMConfig& serverACM() const;
     Ice::Identity stringToIdentity(const std::string&) const;
@@ -193,6 +195,7 @@ private:
     DynamicLibraryListPtr _dynamicLibraryList;
     Ice::PluginManagerPtr _pluginManager;
     const Ice::ImplicitContextIPtr _implicitContext;
+    const TracerPtr _tracer; // Immutable, not reset by destroy().
     IceUtil::StringConverterPtr _stringConverter;
     IceUtil::WstringConverterPtr _wstringConverter;
     bool _adminEnabled;
@@ -271,14 +271,18 @@ public:
         return _current.adapter->getName();
     }
 
-    ConnectionInfoPtr
+    const ConnectionInfoPtr&
     getConnectionInfo() const
     {
-        if(_current.con)
+        //
+        // Cache the connection information, it's needed by most of the
+        // connection attributes and retrieving it locks the connection.
+        //
+        if(_current.con && !_connectionInfo)
         {
-            return _current.con->getInfo();
+            _connectionInfo = _current.con->getInfo();
         }
-        return 0;
+        return _connectionInfo;
     }
 
     EndpointPtr
@@ -324,6 +328,7 @@ private:
     const Current& _current;
     const int _size;
     mutable string _id;
+    mutable ConnectionInfoPtr _connectionInfo;
     mutable EndpointInfoPtr _endpointInfo;
 };
 
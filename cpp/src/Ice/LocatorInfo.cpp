@@ -18,6 +18,7 @@
 #include <Ice/Reference.h>
 #include <Ice/Functional.h>
 #include <Ice/Properties.h>
+#include <Ice/BasicStream.h>
 #include <iterator>
 
 using namespace std;
@@ -68,25 +69,41 @@ public:
 
     virtual void send()
     {
-        try
-        {
-            _locatorInfo->getLocator()->begin_findAdapterById(
-                _ref->getAdapterId(),
-                newCallback_Locator_findAdapterById(static_cast<LocatorInfo::Request*>(this),
-                                                    &LocatorInfo::Request::response,
-                                                    &LocatorInfo::Request::exception));
-        }
-        catch(const Ice::Exception& ex)
-        {
-            exception(ex);
-        }
+        _locatorInfo->sendAdapterRequest(_ref->getAdapterId(), this);
     }
 };
 
+class AdapterBatchCallback : public IceUtil::Shared
+{
+public:
+
+    AdapterBatchCallback(const LocatorInfoPtr& locatorInfo, const LocatorInfo::AdapterRequestSeq& batch) :
+        _locatorInfo(locatorInfo), _batch(batch)
+    {
+    }
+
+    void response(bool ok, const pair<const Byte*, const Byte*>& outParams)
+    {
+        _locatorInfo->adapterBatchResponse(_batch, ok, outParams);
+    }
+
+    void exception(const Ice::Exception& ex)
+    {
+        _locatorInfo->adapterBatchException(_batch, ex);
+    }
+
+private:
+
+    const LocatorInfoPtr _locatorInfo;
+    const LocatorInfo::AdapterRequestSeq _batch;
+};
+typedef IceUtil::Handle<AdapterBatchCallback> AdapterBatchCallbackPtr;
+
 }
 
 IceInternal::LocatorManager::LocatorManager(const Ice::PropertiesPtr& properties) :
     _background(properties->getPropertyAsInt("Ice.BackgroundLocatorCacheUpdates") > 0),
+    _batch(properties->getPropertyAsInt("Ice.BatchLocatorRequests") > 0),
     _tableHint(_table.end())
 {
 }
@@ -154,7 +171,7 @@ IceInternal::LocatorManager::get(const LocatorPrx& loc)
         _tableHint = _table.insert(_tableHint,
                                    pair<const LocatorPrx, LocatorInfoPtr>(locator,
                                                                           new LocatorInfo(locator, t->second,
-                                                                                          _background)));
+                                                                                          _background, _batch)));
     }
     else
     {
@@ -497,10 +514,13 @@ IceInternal::LocatorInfo::Request::exception(const Ice::Exception& ex)
     }
 }
 
-IceInternal::LocatorInfo::LocatorInfo(const LocatorPrx& locator, const LocatorTablePtr& table, bool background) :
+IceInternal::LocatorInfo::LocatorInfo(const LocatorPrx& locator, const LocatorTablePtr& table, bool background,
+                                      bool batch) :
     _locator(locator),
     _table(table),
-    _background(background)
+    _background(background),
+    _batchAdapterRequests(batch),
+    _adapterBatchInProgress(false)
 {
     assert(_locator);
     assert(_table);
@@ -714,6 +734,124 @@ IceInternal::LocatorInfo::clearCache(const ReferencePtr& ref)
     }
 }
 
+void
+IceInternal::LocatorInfo::sendAdapterRequest(const string& adapterId, const RequestPtr& request)
+{
+    AdapterRequestSeq batch;
+    {
+        IceUtil::Mutex::Lock sync(*this);
+        if(_batchAdapterRequests)
+        {
+            //
+            // If a batch is already being sent, the request is sent with
+            // the next batch once the response for this batch is received.
+            //
+            _adapterBatch.push_back(make_pair(adapterId, request));
+            if(_adapterBatchInProgress)
+            {
+                return;
+            }
+            _adapterBatchInProgress = true;
+            batch.swap(_adapterBatch);
+        }
+    }
+
+    if(batch.empty())
+    {
+        findAdapterById(adapterId, request);
+    }
+    else
+    {
+        sendAdapterBatch(batch);
+    }
+}
+
+void
+IceInternal::LocatorInfo::adapterBatchResponse(const AdapterRequestSeq& batch, bool ok,
+                                               const pair<const Byte*, const Byte*>& outParams)
+{
+    vector<ObjectPrx> proxies;
+    if(ok)
+    {
+        try
+        {
+            BasicStream is(_locator->__reference()->getInstance().get(), _locator->ice_getEncodingVersion(),
+                           outParams.first, outParams.second);
+            is.startReadEncaps();
+            is.read(proxies);
+            is.endReadEncaps();
+        }
+        catch(const Ice::LocalException&)
+        {
+            ok = false;
+        }
+    }
+
+    if(!ok || proxies.size() != batch.size())
+    {
+        //
+        // The locator doesn't implement findAdaptersById as expected,
+        // send the requests individually.
+        //
+        adapterBatchException(batch, OperationNotExistException(__FILE__, __LINE__));
+        return;
+    }
+
+    flushAdapterBatch();
+
+    for(AdapterRequestSeq::size_type i = 0; i < batch.size(); ++i)
+    {
+        if(proxies[i])
+        {
+            batch[i].second->response(proxies[i]);
+        }
+        else
+        {
+            //
+            // The adapter is unknown or inactive, findAdapterById tells
+            // which one it is.
+            //
+            findAdapterById(batch[i].first, batch[i].second);
+        }
+    }
+}
+
+void
+IceInternal::LocatorInfo::adapterBatchException(const AdapterRequestSeq& batch, const Ice::Exception& ex)
+{
+    bool unsupported = dynamic_cast<const OperationNotExistException*>(&ex) != 0;
+    if(unsupported)
+    {
+        //
+        // The locator isn't an IceGrid locator or it doesn't support
+        // findAdaptersById, disable batching for this locator.
+        //
+        IceUtil::Mutex::Lock sync(*this);
+        if(_batchAdapterRequests && _locator->__reference()->getInstance()->traceLevels()->location >= 1)
+        {
+            Trace out(_locator->__reference()->getInstance()->initializationData().logger,
+                      _locator->__reference()->getInstance()->traceLevels()->locationCat);
+            out << "locator doesn't support batched adapter requests\n";
+            out << "locator = " << _locator;
+        }
+        _batchAdapterRequests = false;
+    }
+
+    flushAdapterBatch();
+
+    for(AdapterRequestSeq::const_iterator p = batch.begin(); p != batch.end(); ++p)
+    {
+        if(unsupported)
+        {
+            findAdapterById(p->first, p->second);
+        }
+        else
+        {
+            p->second->exception(ex);
+        }
+    }
+}
+
 void
 IceInternal::LocatorInfo::getEndpointsException(const ReferencePtr& ref, const Ice::Exception& exc)
 {
@@ -874,6 +1012,97 @@ IceInternal::LocatorInfo::getObjectRequest(const ReferencePtr& ref)
     return request;
 }
 
+void
+IceInternal::LocatorInfo::findAdapterById(const string& adapterId, const RequestPtr& request)
+{
+    try
+    {
+        _locator->begin_findAdapterById(adapterId,
+                                        newCallback_Locator_findAdapterById(request,
+                                                                            &LocatorInfo::Request::response,
+                                                                            &LocatorInfo::Request::exception));
+    }
+    catch(const Ice::Exception& ex)
+    {
+        request->exception(ex);
+    }
+}
+
+void
+IceInternal::LocatorInfo::sendAdapterBatch(const AdapterRequestSeq& batch)
+{
+    assert(!batch.empty());
+    const InstancePtr instance = _locator->__reference()->getInstance();
+    if(instance->traceLevels()->location >= 2)
+    {
+        Trace out(instance->initializationData().logger, instance->traceLevels()->locationCat);
+        out << "searching for " << batch.size() << " adapters by id with a single request\nadapters = ";
+        for(AdapterRequestSeq::const_iterator p = batch.begin(); p != batch.end(); ++p)
+        {
+            if(p != batch.begin())
+            {
+                out << ", ";
+            }
+            out << p->first;
+        }
+    }
+
+    try
+    {
+        BasicStream os(instance.get(), _locator->ice_getEncodingVersion());
+        os.startWriteEncaps(_locator->ice_getEncodingVersion(), DefaultFormat);
+        os.writeSize(static_cast<Int>(batch.size()));
+        for(AdapterRequestSeq::const_iterator p = batch.begin(); p != batch.end(); ++p)
+        {
+            os.write(p->first);
+        }
+        os.endWriteEncaps();
+
+        AdapterBatchCallbackPtr cb = new AdapterBatchCallback(this, batch);
+        _locator->begin_ice_invoke("findAdaptersById", Idempotent, make_pair(os.b.begin(), os.b.end()),
+                                   newCallback_Object_ice_invoke(cb, &AdapterBatchCallback::response,
+                                                                 &AdapterBatchCallback::exception));
+    }
+    catch(const Ice::Exception& ex)
+    {
+        adapterBatchException(batch, ex);
+    }
+}
+
+void
+IceInternal::LocatorInfo::flushAdapterBatch()
+{
+    //
+    // Send the requests queued while the previous batch was pending.
+    //
+    AdapterRequestSeq batch;
+    bool batchAdapterRequests;
+    {
+        IceUtil::Mutex::Lock sync(*this);
+        assert(_adapterBatchInProgress);
+        batch.swap(_adapterBatch);
+        batchAdapterRequests = _batchAdapterRequests;
+        _adapterBatchInProgress = !batch.empty() && batchAdapterRequests;
+    }
+
+    if(batch.empty())
+    {
+        return;
+    }
+
+    if(batchAdapterRequests)
+    {
+        sendAdapterBatch(batch);
+    }
+    else
+    {
+        for(AdapterRequestSeq::const_iterator p = batch.begin(); p != batch.end(); ++p)
+        {
+            findAdapterById(p->first, p->second);
+        }
+    }
+}
+
 void
 IceInternal::LocatorInfo::finishRequest(const ReferencePtr& ref,
                                         const vector<ReferencePtr>& wellKnownRefs,
@@ -44,6 +44,7 @@ public:
 private:
 
     const bool _background;
+    const bool _batch;
 
     std::map<Ice::LocatorPrx, LocatorInfoPtr> _table;
     std::map<Ice::LocatorPrx, LocatorInfoPtr>::iterator _tableHint;
@@ -135,8 +136,9 @@ public:
         IceUtil::UniquePtr<Ice::Exception> _exception;
     };
     typedef IceUtil::Handle<Request> RequestPtr;
+    typedef std::vector<std::pair<std::string, RequestPtr> > AdapterRequestSeq;
 
-    LocatorInfo(const Ice::LocatorPrx&, const LocatorTablePtr&, bool);
+    LocatorInfo(const Ice::LocatorPrx&, const LocatorTablePtr&, bool, bool);
 
     void destroy();
 
@@ -166,6 +168,15 @@ public:
 
     void clearCache(const ReferencePtr&);
 
+    //
+    // With Ice.BatchLocatorRequests, adapter requests sent while
+    // another batch is pending are queued and sent together with the
+    // findAdaptersById operation of the IceGrid locator.
+    //
+    void sendAdapterRequest(const std::string&, const RequestPtr&);
+    void adapterBatchResponse(const AdapterRequestSeq&, bool, const std::pair<const Ice::Byte*, const Ice::Byte*>&);
+    void adapterBatchException(const AdapterRequestSeq&, const Ice::Exception&);
+
 private:
 
     void getEndpointsException(const ReferencePtr&, const Ice::Exception&);
@@ -176,6 +187,11 @@ private:
     RequestPtr getObjectRequest(const ReferencePtr&);
 
     void finishRequest(const ReferencePtr&, const std::vector<ReferencePtr>&, const Ice::ObjectPrx&, bool);
+
+    void findAdapterById(const std::string&, const RequestPtr&);
+    void sendAdapterBatch(const AdapterRequestSeq&);
+    void flushAdapterBatch();
+
     friend class Request;
     friend class RequestCallback;
 
@@ -184,6 +200,10 @@ private:
     const LocatorTablePtr _table;
     const bool _background;
 
+    bool _batchAdapterRequests;
+    bool _adapterBatchInProgress;
+    AdapterRequestSeq _adapterBatch;
+
     std::map<std::string, RequestPtr> _adapterRequests;
     std::map<Ice::Identity, RequestPtr> _objectRequests;
 };
@@ -68,6 +68,7 @@ OBJS	       =  .\Acceptor.obj \
 		  .\CommunicatorI.obj \
 		  .\ConnectionFactory.obj \
 		  .\ConnectionI.obj \
+		  .\ConnectionPoolRequestHandler.obj \
 		  .\ConnectionRequestHandler.obj \
 		  .\Connector.obj \
 		  .\ConnectRequestHandler.obj \
@@ -140,6 +141,7 @@ OBJS	       =  .\Acceptor.obj \
 		  .\TcpTransceiver.obj \
 		  .\ThreadPool.obj \
 		  .\TraceLevels.obj \
+		  .\Tracer.obj \
 		  .\TraceUtil.obj \
 		  .\Transceiver.obj \
 		  .\UdpConnector.obj \
@@ -159,12 +161,12 @@ RC_SRCS		= EventLoggerMsg.rc
 
 !include $(top_srcdir)\config\Make.rules.mak
 
-CPPFLAGS	= -I.. $(CPPFLAGS) -DICE_API_EXPORTS -DWIN32_LEAN_AND_MEAN -bigobj
+CPPFLAGS	= -I.. $(CPPFLAGS) -DICE_API_EXPORTS -DWIN32_LEAN_AND_MEAN -bigobj $(ZLIB_FLAGS)
 !if "$(UNIQUE_DLL_NAMES)" == "yes"
 CPPFLAGS	= $(CPPFLAGS) -DCOMPSUFFIX=\"$(COMPSUFFIX)\"
 !endif
 SLICE2CPPFLAGS	= --ice --include-dir Ice --dll-export ICE_API $(SLICE2CPPFLAGS)
-LINKWITH        =  $(BASELIBS) $(BZIP2_LIBS) $(ICE_OS_LIBS)
+LINKWITH        =  $(BASELIBS) $(BZIP2_LIBS) $(ZLIB_LIBS) $(ICE_OS_LIBS)
 
 PDBFLAGS        = /pdb:$(DLLNAME:.dll=.pdb)
 LD_DLLFLAGS	= $(LD_DLLFLAGS) /entry:"ice_DLL_Main"
@@ -17,6 +17,7 @@
 #include <Ice/LoggerUtil.h>
 
 #include <IceUtil/StringUtil.h>
+#include <IceUtil/ThreadException.h>
 
 using namespace std;
 using namespace Ice;
@@ -33,6 +34,8 @@ const string suffixes[] =
     "Accept.*",
     "Reject.*",
     "RetainDetached",
+    "Histogram",
+    "Shards",
     "Map.*",
 };
 
@@ -71,6 +74,64 @@ validateProperties(const string& prefix, const PropertiesPtr& properties)
     }
 }
 
+IceUtilInternal::Atomic nextThreadIndex;
+
+#if defined(_WIN32)
+DWORD threadIndexKey;
+#else
+pthread_key_t threadIndexKey;
+#endif
+
+class Init
+{
+public:
+
+    Init()
+    {
+#if defined(_WIN32)
+        threadIndexKey = TlsAlloc();
+        if(threadIndexKey == TLS_OUT_OF_INDEXES)
+        {
+            throw IceUtil::ThreadSyscallException(__FILE__, __LINE__, GetLastError());
+        }
+#else
+        int err = pthread_key_create(&threadIndexKey, 0);
+        if(err != 0)
+        {
+            throw IceUtil::ThreadSyscallException(__FILE__, __LINE__, err);
+        }
+#endif
+    }
+
+    ~Init()
+    {
+#if defined(_WIN32)
+        TlsFree(threadIndexKey);
+#else
+        pthread_key_delete(threadIndexKey);
+#endif
+    }
+};
+
+Init init;
+
+int
+parseShards(const string& prefix, const PropertiesPtr& properties, bool mergeable)
+{
+    int shards = properties->getPropertyAsInt(prefix + "Shards");
+    if(shards > 0 && !mergeable)
+    {
+        //
+        // The shards can't be merged without a mergeMetrics overload
+        // for the metrics type of the map.
+        //
+        Warning out(getProcessLogger());
+        out << "ignoring `" << prefix << "Shards': the metrics of this map can't be sharded";
+        return 0;
+    }
+    return max(shards, 0);
+}
+
 vector<MetricsMapI::RegExpPtr>
 parseRule(const PropertiesPtr& properties, const string& name)
 {
@@ -145,11 +206,13 @@ MetricsMapI::RegExp::match(const string& value)
 #endif
 }
 
-MetricsMapI::MetricsMapI(const std::string& mapPrefix, const PropertiesPtr& properties) :
+MetricsMapI::MetricsMapI(const std::string& mapPrefix, const PropertiesPtr& properties, bool mergeable) :
     _properties(properties->getPropertiesForPrefix(mapPrefix)),
     _retain(properties->getPropertyAsIntWithDefault(mapPrefix + "RetainDetached", 10)),
     _accept(parseRule(properties, mapPrefix + "Accept")),
-    _reject(parseRule(properties, mapPrefix + "Reject"))
+    _reject(parseRule(properties, mapPrefix + "Reject")),
+    _histogram(properties->getPropertyAsInt(mapPrefix + "Histogram") > 0),
+    _shards(parseShards(mapPrefix, properties, mergeable))
 {
     validateProperties(mapPrefix, properties);
 
@@ -203,7 +266,9 @@ MetricsMapI::MetricsMapI(const MetricsMapI& map) :
     _groupBySeparators(map._groupBySeparators),
     _retain(map._retain),
     _accept(map._accept),
-    _reject(map._reject)
+    _reject(map._reject),
+    _histogram(map._histogram),
+    _shards(map._shards)
 {
 }
 
@@ -213,6 +278,384 @@ MetricsMapI::getProperties() const
     return _properties;
 }
 
+void
+MetricsMapI::addToHistogram(LongSeq& buckets, Long value)
+{
+    //
+    // The first 16 buckets are one microsecond wide. Above, the three
+    // bits following the most significant bit select one of the 8
+    // buckets of the value's power of two.
+    //
+    size_t index;
+    if(value < 16)
+    {
+        index = value > 0 ? static_cast<size_t>(value) : 0;
+    }
+    else
+    {
+        int exponent = 4;
+        while((value >> (exponent + 1)) != 0)
+        {
+            ++exponent;
+        }
+        index = 16 + (exponent - 4) * 8 + static_cast<size_t>((value >> (exponent - 3)) & 7);
+    }
+
+    if(index >= buckets.size())
+    {
+        buckets.resize(index + 1, 0);
+    }
+    ++buckets[index];
+}
+
+void
+MetricsMapI::mergeHistogram(LongSeq& buckets, const LongSeq& other)
+{
+    if(other.size() > buckets.size())
+    {
+        buckets.resize(other.size(), 0);
+    }
+    for(size_t i = 0; i < other.size(); ++i)
+    {
+        buckets[i] += other[i];
+    }
+}
+
+Long
+MetricsMapI::getUpperBound(size_t index)
+{
+    //
+    // Returns the largest value that falls in the given bucket.
+    //
+    if(index < 16)
+    {
+        return static_cast<Long>(index);
+    }
+    int exponent = 4 + static_cast<int>((index - 16) / 8);
+    Long width = static_cast<Long>(1) << (exponent - 3);
+    return (8 + static_cast<Long>((index - 16) % 8)) * width + width - 1;
+}
+
+StringLongDict
+MetricsMapI::getQuantiles(const LongSeq& buckets)
+{
+    static const char* names[] = { "p50", "p90", "p99", "p999" };
+    static const Long permille[] = { 500, 900, 990, 999 };
+
+    Long count = 0;
+    for(LongSeq::const_iterator p = buckets.begin(); p != buckets.end(); ++p)
+    {
+        count += *p;
+    }
+
+    StringLongDict quantiles;
+    if(count == 0)
+    {
+        return quantiles;
+    }
+
+    size_t q = 0;
+    Long cumulated = 0;
+    for(size_t i = 0; i < buckets.size() && q < sizeof(permille) / sizeof(*permille); ++i)
+    {
+        cumulated += buckets[i];
+        while(q < sizeof(permille) / sizeof(*permille) && cumulated * 1000 >= count * permille[q])
+        {
+            quantiles[names[q++]] = getUpperBound(i);
+        }
+    }
+    return quantiles;
+}
+
+size_t
+MetricsMapI::getThreadIndex()
+{
+    //
+    // The index is assigned the first time a thread asks for it, so that
+    // threads are spread evenly over the shards.
+    //
+#if defined(_WIN32)
+    size_t index = reinterpret_cast<size_t>(TlsGetValue(threadIndexKey));
+#else
+    size_t index = reinterpret_cast<size_t>(pthread_getspecific(threadIndexKey));
+#endif
+    if(index == 0)
+    {
+        index = static_cast<size_t>(nextThreadIndex.fetch_add(1)) + 1;
+#if defined(_WIN32)
+        TlsSetValue(threadIndexKey, reinterpret_cast<void*>(index));
+#else
+        pthread_setspecific(threadIndexKey, reinterpret_cast<void*>(index));
+#endif
+    }
+    return index - 1;
+}
+
+Metrics&
+IceMX::mergeMetrics(Metrics& m, const Metrics& other)
+{
+    m.total += other.total;
+    m.current += other.current;
+    m.totalLifetime += other.totalLifetime;
+    m.failures += other.failures;
+    return m;
+}
+
+ThreadMetrics&
+IceMX::mergeMetrics(ThreadMetrics& m, const ThreadMetrics& other)
+{
+    mergeMetrics(static_cast<Metrics&>(m), other);
+    m.inUseForIO += other.inUseForIO;
+    m.inUseForUser += other.inUseForUser;
+    m.inUseForOther += other.inUseForOther;
+    return m;
+}
+
+DispatchMetrics&
+IceMX::mergeMetrics(DispatchMetrics& m, const DispatchMetrics& other)
+{
+    mergeMetrics(static_cast<Metrics&>(m), other);
+    m.userException += other.userException;
+    m.size += other.size;
+    m.replySize += other.replySize;
+    return m;
+}
+
+ChildInvocationMetrics&
+IceMX::mergeMetrics(ChildInvocationMetrics& m, const ChildInvocationMetrics& other)
+{
+    mergeMetrics(static_cast<Metrics&>(m), other);
+    m.size += other.size;
+    m.replySize += other.replySize;
+    return m;
+}
+
+RemoteMetrics&
+IceMX::mergeMetrics(RemoteMetrics& m, const RemoteMetrics& other)
+{
+    mergeMetrics(static_cast<ChildInvocationMetrics&>(m), other);
+    return m;
+}
+
+CollocatedMetrics&
+IceMX::mergeMetrics(CollocatedMetrics& m, const CollocatedMetrics& other)
+{
+    mergeMetrics(static_cast<ChildInvocationMetrics&>(m), other);
+    return m;
+}
+
+InvocationMetrics&
+IceMX::mergeMetrics(InvocationMetrics& m, const InvocationMetrics& other)
+{
+    mergeMetrics(static_cast<Metrics&>(m), other);
+    m.retry += other.retry;
+    m.userException += other.userException;
+    return m;
+}
+
+ConnectionMetrics&
+IceMX::mergeMetrics(ConnectionMetrics& m, const ConnectionMetrics& other)
+{
+    mergeMetrics(static_cast<Metrics&>(m), other);
+    m.receivedBytes += other.receivedBytes;
+    m.sentBytes += other.sentBytes;
+    return m;
+}
+
+IceMX::MetricsVisitor::~MetricsVisitor()
+{
+    // Out of line to avoid weak vtable
+}
+
+void
+IceMX::visitMetrics(const Metrics& m, MetricsVisitor& visitor)
+{
+    visitor.counter("", m.total);
+    visitor.gauge("current", m.current);
+    visitor.counter("lifetime_microseconds", m.totalLifetime);
+    visitor.counter("failures", m.failures);
+}
+
+void
+IceMX::visitMetrics(const ThreadMetrics& m, MetricsVisitor& visitor)
+{
+    visitMetrics(static_cast<const Metrics&>(m), visitor);
+    visitor.gauge("in_use_for_io", m.inUseForIO);
+    visitor.gauge("in_use_for_user", m.inUseForUser);
+    visitor.gauge("in_use_for_other", m.inUseForOther);
+}
+
+void
+IceMX::visitMetrics(const DispatchMetrics& m, MetricsVisitor& visitor)
+{
+    visitMetrics(static_cast<const Metrics&>(m), visitor);
+    visitor.counter("user_exceptions", m.userException);
+    visitor.counter("size_bytes", m.size);
+    visitor.counter("reply_size_bytes", m.replySize);
+}
+
+void
+IceMX::visitMetrics(const ChildInvocationMetrics& m, MetricsVisitor& visitor)
+{
+    visitMetrics(static_cast<const Metrics&>(m), visitor);
+    visitor.counter("size_bytes", m.size);
+    visitor.counter("reply_size_bytes", m.replySize);
+}
+
+void
+IceMX::visitMetrics(const InvocationMetrics& m, MetricsVisitor& visitor)
+{
+    visitMetrics(static_cast<const Metrics&>(m), visitor);
+    visitor.counter("retries", m.retry);
+    visitor.counter("user_exceptions", m.userException);
+}
+
+void
+IceMX::visitMetrics(const ConnectionMetrics& m, MetricsVisitor& visitor)
+{
+    visitMetrics(static_cast<const Metrics&>(m), visitor);
+    visitor.counter("received_bytes", m.receivedBytes);
+    visitor.counter("sent_bytes", m.sentBytes);
+}
+
+OpenMetricsWriter::Visitor::Visitor(OpenMetricsWriter& writer, const string& family, const string& labels) :
+    _writer(writer), _family(family), _labels(labels)
+{
+}
+
+void
+OpenMetricsWriter::Visitor::counter(const char* name, Long value)
+{
+    const string family = *name ? _family + "_" + name : _family;
+    _writer.add(family, "counter", family + "_total", _labels, value);
+}
+
+void
+OpenMetricsWriter::Visitor::gauge(const char* name, Long value)
+{
+    const string family = _family + "_" + name;
+    _writer.add(family, "gauge", family, _labels, value);
+}
+
+void
+OpenMetricsWriter::addFailures(const string& family, const string& labels, const StringIntDict& failures)
+{
+    const string name = family + "_exceptions";
+    for(StringIntDict::const_iterator p = failures.begin(); p != failures.end(); ++p)
+    {
+        add(name, "counter", name + "_total", labels + ",exception=\"" + escape(p->first) + "\"", p->second);
+    }
+}
+
+void
+OpenMetricsWriter::addHistogram(const string& family, const string& labels, const LongSeq& buckets, Long sum)
+{
+    //
+    // Only the non-empty buckets are written, the cumulative counts of
+    // the omitted buckets can be inferred from the next written bucket.
+    //
+    const string name = family + "_lifetime_distribution_microseconds";
+    Long count = 0;
+    for(size_t i = 0; i < buckets.size(); ++i)
+    {
+        if(buckets[i] > 0)
+        {
+            count += buckets[i];
+            ostringstream le;
+            le << MetricsMapI::getUpperBound(i);
+            add(name, "histogram", name + "_bucket", labels + ",le=\"" + le.str() + "\"", count);
+        }
+    }
+    add(name, "histogram", name + "_bucket", labels + ",le=\"+Inf\"", count);
+    add(name, "histogram", name + "_count", labels, count);
+    add(name, "histogram", name + "_sum", labels, sum);
+}
+
+string
+OpenMetricsWriter::str() const
+{
+    string str;
+    for(map<string, Family>::const_iterator p = _families.begin(); p != _families.end(); ++p)
+    {
+        str += "# TYPE " + p->first + " " + p->second.type + "\n";
+        str += p->second.samples;
+    }
+    str += "# EOF\n";
+    return str;
+}
+
+string
+OpenMetricsWriter::escape(const string& value)
+{
+    string result;
+    result.reserve(value.size());
+    for(string::const_iterator p = value.begin(); p != value.end(); ++p)
+    {
+        switch(*p)
+        {
+        case '\\':
+            result += "\\\\";
+            break;
+        case '"':
+            result += "\\\"";
+            break;
+        case '\n':
+            result += "\\n";
+            break;
+        default:
+            result += *p;
+            break;
+        }
+    }
+    return result;
+}
+
+string
+OpenMetricsWriter::toName(const string& value)
+{
+    //
+    // Convert a CamelCase map name to lower case words separated by
+    // underscores, for example ConnectionEstablishment becomes
+    // connection_establishment.
+    //
+    string result;
+    for(string::size_type i = 0; i < value.size(); ++i)
+    {
+        char c = value[i];
+        if(c >= 'A' && c <= 'Z')
+        {
+            char p = i > 0 ? value[i - 1] : 'A';
+            if((p >= 'a' && p <= 'z') || (p >= '0' && p <= '9'))
+            {
+                result += '_';
+            }
+            result += static_cast<char>(c - 'A' + 'a');
+        }
+        else if((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9'))
+        {
+            result += c;
+        }
+        else
+        {
+            result += '_';
+        }
+    }
+    return result;
+}
+
+void
+OpenMetricsWriter::add(const string& family, const char* type, const string& sample, const string& labels, Long value)
+{
+    Family& f = _families[family];
+    if(f.type.empty())
+    {
+        f.type = type;
+    }
+    ostringstream os;
+    os << sample << '{' << labels << "} " << value << '\n';
+    f.samples += os.str();
+}
+
 MetricsMapFactory::MetricsMapFactory(Updater* updater) : _updater(updater)
 {
 }
@@ -337,6 +780,17 @@ MetricsViewI::getMetrics()
     return metrics;
 }
 
+void
+MetricsViewI::writeOpenMetrics(OpenMetricsWriter& writer) const
+{
+    const string labels = "view=\"" + OpenMetricsWriter::escape(_name) + "\",";
+    for(map<string, MetricsMapIPtr>::const_iterator p = _maps.begin(); p != _maps.end(); ++p)
+    {
+        const string name = OpenMetricsWriter::toName(p->first);
+        p->second->writeOpenMetrics(writer, name, "ice_" + name, labels);
+    }
+}
+
 MetricsFailuresSeq
 MetricsViewI::getFailures(const string& mapName)
 {
@@ -587,6 +1041,18 @@ MetricsAdminI::getMetricsFailures(const string& viewName, const string& map, con
     return MetricsFailures();
 }
 
+string
+MetricsAdminI::getOpenMetrics() const
+{
+    Lock sync(*this);
+    OpenMetricsWriter writer;
+    for(std::map<string, MetricsViewIPtr>::const_iterator p = _views.begin(); p != _views.end(); ++p)
+    {
+        p->second->writeOpenMetrics(writer);
+    }
+    return writer.str();
+}
+
 vector<MetricsMapIPtr> 
 MetricsAdminI::getMaps(const string& mapName) const
 {
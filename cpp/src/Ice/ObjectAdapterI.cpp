@@ -31,6 +31,7 @@
 #include <Ice/DefaultsAndOverrides.h>
 #include <Ice/TraceLevels.h>
 #include <Ice/PropertyNames.h>
+#include <Ice/BasicStream.h>
 
 #ifdef _WIN32
 #   include <sys/timeb.h>
@@ -834,6 +835,56 @@ Ice::ObjectAdapterI::getServantManager() const
     return _servantManager;
 }
 
+void
+Ice::ObjectAdapterI::setHttpRequestHandler(const HttpRequestHandlerPtr& handler)
+{
+    IceUtil::Mutex::Lock sync(_httpHandlerMutex);
+    _httpHandler = handler;
+}
+
+HttpRequestHandlerPtr
+Ice::ObjectAdapterI::getHttpRequestHandler() const
+{
+    IceUtil::Mutex::Lock sync(_httpHandlerMutex);
+    return _httpHandler;
+}
+
+bool
+Ice::ObjectAdapterI::isInlineDispatch(BasicStream* is) const
+{
+    //
+    // No mutex lock necessary, _inlineDispatch is immutable after
+    // initialization.
+    //
+    if(_inlineDispatch.empty())
+    {
+        return false;
+    }
+
+    //
+    // Peek at the operation of the request, the stream position is
+    // restored for the dispatch. Malformed requests are left to the
+    // dispatch to report.
+    //
+    Buffer::Container::iterator start = is->i;
+    string operation;
+    try
+    {
+        Identity id;
+        vector<string> facetPath;
+        is->read(id);
+        is->read(facetPath);
+        is->read(operation, false);
+    }
+    catch(const LocalException&)
+    {
+        is->i = start;
+        return false;
+    }
+    is->i = start;
+    return _inlineDispatch.find(operation) != _inlineDispatch.end();
+}
+
 IceInternal::ACMConfig
 Ice::ObjectAdapterI::getACM() const
 {
@@ -937,6 +988,19 @@ Ice::ObjectAdapterI::initialize(const RouterPrx& router)
             }
         }
 
+        StringSeq inlineDispatch = properties->getPropertyAsList(_name + ".InlineDispatch");
+        _inlineDispatch.insert(inlineDispatch.begin(), inlineDispatch.end());
+
+        //
+        // The window in microseconds during which the replies sent while
+        // other requests are dispatched are coalesced, 0 disables it.
+        //
+        Int coalesceReplies = properties->getPropertyAsInt(_name + ".CoalesceReplies");
+        if(coalesceReplies > 0)
+        {
+            _coalesceReplies = IceUtil::Time::microSeconds(coalesceReplies);
+        }
+
         int threadPoolSize = properties->getPropertyAsInt(_name + ".ThreadPool.Size");
         int threadPoolSizeMax = properties->getPropertyAsInt(_name + ".ThreadPool.SizeMax");
         bool hasPriority = properties->getProperty(_name + ".ThreadPool.ThreadPriority") != "";
@@ -1421,7 +1485,9 @@ Ice::ObjectAdapterI::filterProperties(StringSeq& unknownProps)
         "ACM.Heartbeat",
         "ACM.Timeout",
         "AdapterId",
+        "CoalesceReplies",
         "Endpoints",
+        "InlineDispatch",
         "Locator",
         "Locator.EncodingVersion",
         "Locator.EndpointSelection",
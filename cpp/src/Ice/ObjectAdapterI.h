@@ -11,8 +11,10 @@
 #define ICE_OBJECT_ADAPTER_I_H
 
 #include <IceUtil/Shared.h>
+#include <IceUtil/Mutex.h>
 #include <IceUtil/RecMutex.h>
 #include <IceUtil/Monitor.h>
+#include <IceUtil/Time.h>
 #include <Ice/ObjectAdapter.h>
 #include <Ice/InstanceF.h>
 #include <Ice/ObjectAdapterFactoryF.h>
@@ -30,7 +32,16 @@
 #include <Ice/BuiltinSequences.h>
 #include <Ice/Proxy.h>
 #include <Ice/ACM.h>
+#include <Ice/HttpParser.h>
 #include <list>
+#include <set>
+
+namespace IceInternal
+{
+
+class BasicStream;
+
+}
 
 namespace Ice
 {
@@ -99,6 +110,11 @@ public:
     IceInternal::ServantManagerPtr getServantManager() const;
     IceInternal::ACMConfig getACM() const;
     size_t messageSizeMax() const { return _messageSizeMax; }
+    bool isInlineDispatch(IceInternal::BasicStream*) const;
+    IceUtil::Time coalesceReplies() const { return _coalesceReplies; }
+
+    void setHttpRequestHandler(const IceInternal::HttpRequestHandlerPtr&);
+    IceInternal::HttpRequestHandlerPtr getHttpRequestHandler() const;
 
 private:
 
@@ -148,6 +164,15 @@ private:
     bool _noConfig;
     Identity _processId;
     size_t _messageSizeMax;
+    std::set<std::string> _inlineDispatch;
+    IceUtil::Time _coalesceReplies;
+
+    //
+    // The HTTP request handler has its own mutex because it is read by
+    // the incoming connection factories with their mutex locked.
+    //
+    IceUtil::Mutex _httpHandlerMutex;
+    IceInternal::HttpRequestHandlerPtr _httpHandler;
 };
 
 }
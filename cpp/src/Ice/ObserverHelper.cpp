@@ -11,6 +11,7 @@
 #include <Ice/Reference.h>
 #include <Ice/Instance.h>
 #include <Ice/Proxy.h>
+#include <Ice/Tracer.h>
 
 using namespace std;
 using namespace Ice;
@@ -23,8 +24,14 @@ Ice::Context emptyCtx;
 
 }
 
-IceInternal::InvocationObserver::InvocationObserver(IceProxy::Ice::Object* proxy, const string& op, const Context* ctx)
+IceInternal::InvocationObserver::InvocationObserver(IceProxy::Ice::Object* proxy, const string& op, const Context* ctx) :
+    _span(0)
 {
+    if(proxy->__reference()->getInstance()->tracer())
+    {
+        startSpan(proxy, op);
+    }
+
     const CommunicatorObserverPtr& obsv = proxy->__reference()->getInstance()->initializationData().observer;
     if(!obsv)
     {
@@ -41,7 +48,8 @@ IceInternal::InvocationObserver::InvocationObserver(IceProxy::Ice::Object* proxy
     }
 }
 
-IceInternal::InvocationObserver::InvocationObserver(IceInternal::Instance* instance, const string& op)
+IceInternal::InvocationObserver::InvocationObserver(IceInternal::Instance* instance, const string& op) :
+    _span(0)
 {
     const CommunicatorObserverPtr& obsv = instance->initializationData().observer;
     if(!obsv)
@@ -55,6 +63,11 @@ IceInternal::InvocationObserver::InvocationObserver(IceInternal::Instance* insta
 void
 IceInternal::InvocationObserver::attach(IceProxy::Ice::Object* proxy, const string& op, const Context* ctx)
 {
+    if(proxy->__reference()->getInstance()->tracer())
+    {
+        startSpan(proxy, op);
+    }
+
     const CommunicatorObserverPtr& obsv = proxy->__reference()->getInstance()->initializationData().observer;
     if(!obsv)
     {
@@ -82,3 +95,64 @@ IceInternal::InvocationObserver::attach(IceInternal::Instance* instance, const s
 
     attach(obsv->getInvocationObserver(0, op, emptyCtx));
 }
+
+void
+IceInternal::InvocationObserver::startSpan(IceProxy::Ice::Object* proxy, const string& op)
+{
+    if(_span)
+    {
+        finishSpan();
+    }
+    const ReferencePtr& ref = proxy->__reference();
+    _span = ref->getInstance()->tracer()->startInvocation(ref->getIdentity(), op);
+}
+
+void
+IceInternal::InvocationObserver::finishSpan()
+{
+    TraceSpan* span = _span;
+    _span = 0;
+    span->tracer->finish(span);
+}
+
+void
+IceInternal::InvocationObserver::spanFailed(const string& reason)
+{
+    _span->span.failure = reason;
+}
+
+void
+IceInternal::InvocationObserver::spanUserException()
+{
+    _span->span.userException = true;
+}
+
+void
+IceInternal::DispatchObserver::startSpan(Instance* instance, const Current& current)
+{
+    const TracerPtr& tracer = instance->tracer();
+    if(tracer)
+    {
+        _span = tracer->startDispatch(current);
+    }
+}
+
+void
+IceInternal::DispatchObserver::finishSpan()
+{
+    TraceSpan* span = _span;
+    _span = 0;
+    span->tracer->finish(span);
+}
+
+void
+IceInternal::DispatchObserver::spanFailed(const string& reason)
+{
+    _span->span.failure = reason;
+}
+
+void
+IceInternal::DispatchObserver::spanUserException()
+{
+    _span->span.userException = true;
+}
@@ -16,6 +16,7 @@
 #include <Ice/LocalException.h>
 #include <Ice/ReplyStatus.h>
 #include <Ice/ImplicitContextI.h>
+#include <Ice/Tracer.h>
 
 using namespace std;
 using namespace IceUtil;
@@ -329,7 +330,14 @@ Outgoing::Outgoing(IceProxy::Ice::Object* proxy, const string& operation, Operat
 
         _os.write(static_cast<Ice::Byte>(mode));
 
-        if(context != 0)
+        if(_observer.getSpan())
+        {
+            //
+            // Sampled invocation, add the trace context to the request context
+            //
+            Tracer::writeContext(&_os, context, _proxy->__reference().get(), *_observer.getSpan());
+        }
+        else if(context != 0)
         {
             //
             // Explicit context
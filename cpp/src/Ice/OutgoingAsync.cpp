@@ -16,6 +16,7 @@
 #include <Ice/LocalException.h>
 #include <Ice/ReplyStatus.h>
 #include <Ice/ImplicitContextI.h>
+#include <Ice/Tracer.h>
 #include <Ice/ThreadPool.h>
 #include <Ice/RetryQueue.h>
 
@@ -223,7 +224,7 @@ ProxyOutgoingAsyncBase::invokeImpl(bool userThread)
             try
             {
                 _sent = false;
-                _handler = _proxy->__getRequestHandler();
+                _handler = _proxy->__getRequestHandler(selectRequestHandler());
                 AsyncStatus status = _handler->sendAsyncRequest(this);
                 if(status & AsyncStatusSent)
                 {
@@ -339,6 +340,12 @@ ProxyOutgoingAsyncBase::runTimerTask()
     }
 }
 
+bool
+ProxyOutgoingAsyncBase::selectRequestHandler() const
+{
+    return true;
+}
+
 OutgoingAsync::OutgoingAsync(const ObjectPrx& prx,
                              const string& operation,
                              const CallbackBasePtr& delegate,
@@ -395,7 +402,14 @@ OutgoingAsync::prepare(const string& operation, OperationMode mode, const Contex
 
     _os.write(static_cast<Byte>(_mode));
 
-    if(context != 0)
+    if(_observer.getSpan())
+    {
+        //
+        // Sampled invocation, add the trace context to the request context
+        //
+        Tracer::writeContext(&_os, context, ref, *_observer.getSpan());
+    }
+    else if(context != 0)
     {
         //
         // Explicit context
@@ -709,6 +723,12 @@ ProxyGetConnection::invoke()
     invokeImpl(true); // userThread = true
 }
 
+bool
+ProxyGetConnection::selectRequestHandler() const
+{
+    return false; // The connection of a pooled proxy is the connection of its first handler.
+}
+
 ConnectionFlushBatchAsync::ConnectionFlushBatchAsync(const ConnectionIPtr& connection,
                                                      const CommunicatorPtr& communicator,
                                                      const InstancePtr& instance,
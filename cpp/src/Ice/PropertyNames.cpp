@@ -6,7 +6,7 @@
 // ICE_LICENSE file included in this distribution.
 //
 // **********************************************************************
-// Generated by makeprops.py from file ./config/PropertyNames.xml, Tue Apr 28 22:03:41 2015
+// Generated by makeprops.py from file ./config/PropertyNames.xml, Mon Oct 19 04:09:50 2026
 
 // IMPORTANT: Do not edit this file -- any edits made here will be lost!
 
@@ -33,7 +33,9 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Admin.ACM.Close", false, 0),
     IceInternal::Property("Ice.Admin.ACM", false, 0),
     IceInternal::Property("Ice.Admin.AdapterId", false, 0),
+    IceInternal::Property("Ice.Admin.CoalesceReplies", false, 0),
     IceInternal::Property("Ice.Admin.Endpoints", false, 0),
+    IceInternal::Property("Ice.Admin.InlineDispatch", false, 0),
     IceInternal::Property("Ice.Admin.Locator.EndpointSelection", false, 0),
     IceInternal::Property("Ice.Admin.Locator.ConnectionCached", false, 0),
     IceInternal::Property("Ice.Admin.Locator.PreferSecure", false, 0),
@@ -72,15 +74,18 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Admin.Logger.KeepLogs", false, 0),
     IceInternal::Property("Ice.Admin.Logger.KeepTraces", false, 0),
     IceInternal::Property("Ice.Admin.Logger.Properties", false, 0),
+    IceInternal::Property("Ice.Admin.Metrics.HttpResource", false, 0),
     IceInternal::Property("Ice.Admin.ServerId", false, 0),
     IceInternal::Property("Ice.BackgroundLocatorCacheUpdates", false, 0),
     IceInternal::Property("Ice.BatchAutoFlush", true, 0),
     IceInternal::Property("Ice.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("Ice.BatchLocatorRequests", false, 0),
     IceInternal::Property("Ice.ChangeUser", false, 0),
     IceInternal::Property("Ice.ClientAccessPolicyProtocol", false, 0),
     IceInternal::Property("Ice.Compression.Level", false, 0),
     IceInternal::Property("Ice.CollectObjects", false, 0),
     IceInternal::Property("Ice.Config", false, 0),
+    IceInternal::Property("Ice.ConnectionPoolSize", false, 0),
     IceInternal::Property("Ice.ConsoleListener", false, 0),
     IceInternal::Property("Ice.Default.CollocationOptimized", false, 0),
     IceInternal::Property("Ice.Default.EncodingVersion", false, 0),
@@ -116,6 +121,8 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Default.Timeout", false, 0),
     IceInternal::Property("Ice.EventLog.Source", false, 0),
     IceInternal::Property("Ice.FactoryAssemblies", false, 0),
+    IceInternal::Property("Ice.HostResolver.CacheTimeout", false, 0),
+    IceInternal::Property("Ice.HostResolver.NegativeCacheTimeout", false, 0),
     IceInternal::Property("Ice.HTTPProxyHost", false, 0),
     IceInternal::Property("Ice.HTTPProxyPort", false, 0),
     IceInternal::Property("Ice.ImplicitContext", false, 0),
@@ -133,6 +140,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Override.Timeout", false, 0),
     IceInternal::Property("Ice.Override.Secure", false, 0),
     IceInternal::Property("Ice.Package.*", false, 0),
+    IceInternal::Property("Ice.ParallelConnectDelay", false, 0),
     IceInternal::Property("Ice.Plugin.*", false, 0),
     IceInternal::Property("Ice.PluginLoadOrder", false, 0),
     IceInternal::Property("Ice.PreferIPv6Address", false, 0),
@@ -170,11 +178,18 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Trace.Retry", false, 0),
     IceInternal::Property("Ice.Trace.Slicing", false, 0),
     IceInternal::Property("Ice.Trace.ThreadPool", false, 0),
+    IceInternal::Property("Ice.Tracer.BufferSize", false, 0),
+    IceInternal::Property("Ice.Tracer.Enabled", false, 0),
+    IceInternal::Property("Ice.Tracer.File", false, 0),
+    IceInternal::Property("Ice.Tracer.SampleRate", false, 0),
     IceInternal::Property("Ice.UDP.RcvSize", false, 0),
     IceInternal::Property("Ice.UDP.SndSize", false, 0),
     IceInternal::Property("Ice.TCP.Backlog", false, 0),
     IceInternal::Property("Ice.TCP.RcvSize", false, 0),
     IceInternal::Property("Ice.TCP.SndSize", false, 0),
+    IceInternal::Property("Ice.WS.PerMessageDeflate", false, 0),
+    IceInternal::Property("Ice.WS.PerMessageDeflate.NoContextTakeover", false, 0),
+    IceInternal::Property("Ice.WS.PerMessageDeflate.Threshold", false, 0),
     IceInternal::Property("Ice.UseApplicationClassLoader", false, 0),
     IceInternal::Property("Ice.UseSyslog", false, 0),
     IceInternal::Property("Ice.Warn.AMICallback", false, 0),
@@ -198,6 +213,8 @@ const IceInternal::Property IceMXPropsData[] =
     IceInternal::Property("IceMX.Metrics.*.GroupBy", false, 0),
     IceInternal::Property("IceMX.Metrics.*.Map", false, 0),
     IceInternal::Property("IceMX.Metrics.*.RetainDetached", false, 0),
+    IceInternal::Property("IceMX.Metrics.*.Histogram", false, 0),
+    IceInternal::Property("IceMX.Metrics.*.Shards", false, 0),
     IceInternal::Property("IceMX.Metrics.*.Accept", false, 0),
     IceInternal::Property("IceMX.Metrics.*.Reject", false, 0),
     IceInternal::Property("IceMX.Metrics.*", false, 0),
@@ -214,7 +231,9 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Multicast.ACM.Close", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ACM", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.AdapterId", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.CoalesceReplies", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Endpoints", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.InlineDispatch", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.PreferSecure", false, 0),
@@ -251,7 +270,9 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Reply.ACM.Close", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ACM", false, 0),
     IceInternal::Property("IceDiscovery.Reply.AdapterId", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.CoalesceReplies", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Endpoints", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.InlineDispatch", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.PreferSecure", false, 0),
@@ -288,7 +309,9 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Locator.ACM.Close", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ACM", false, 0),
     IceInternal::Property("IceDiscovery.Locator.AdapterId", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.CoalesceReplies", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Endpoints", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.InlineDispatch", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.PreferSecure", false, 0),
@@ -341,7 +364,9 @@ const IceInternal::Property IceGridDiscoveryPropsData[] =
     IceInternal::Property("IceGridDiscovery.Reply.ACM.Close", false, 0),
     IceInternal::Property("IceGridDiscovery.Reply.ACM", false, 0),
     IceInternal::Property("IceGridDiscovery.Reply.AdapterId", false, 0),
+    IceInternal::Property("IceGridDiscovery.Reply.CoalesceReplies", false, 0),
     IceInternal::Property("IceGridDiscovery.Reply.Endpoints", false, 0),
+    IceInternal::Property("IceGridDiscovery.Reply.InlineDispatch", false, 0),
     IceInternal::Property("IceGridDiscovery.Reply.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGridDiscovery.Reply.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceGridDiscovery.Reply.Locator.PreferSecure", false, 0),
@@ -378,7 +403,9 @@ const IceInternal::Property IceGridDiscoveryPropsData[] =
     IceInternal::Property("IceGridDiscovery.Locator.ACM.Close", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.ACM", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.AdapterId", false, 0),
+    IceInternal::Property("IceGridDiscovery.Locator.CoalesceReplies", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.Endpoints", false, 0),
+    IceInternal::Property("IceGridDiscovery.Locator.InlineDispatch", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.Locator.PreferSecure", false, 0),
@@ -485,7 +512,9 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ACM.Close", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ACM", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.AdapterId", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.CoalesceReplies", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Endpoints", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.InlineDispatch", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.PreferSecure", false, 0),
@@ -532,7 +561,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.AdminRouter.ACM.Close", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ACM", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.AdapterId", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.CoalesceReplies", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Endpoints", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.InlineDispatch", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.PreferSecure", false, 0),
@@ -570,7 +601,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.ACM.Close", false, 0),
     IceInternal::Property("IceGrid.Node.ACM", false, 0),
     IceInternal::Property("IceGrid.Node.AdapterId", false, 0),
+    IceInternal::Property("IceGrid.Node.CoalesceReplies", false, 0),
     IceInternal::Property("IceGrid.Node.Endpoints", false, 0),
+    IceInternal::Property("IceGrid.Node.InlineDispatch", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.PreferSecure", false, 0),
@@ -607,6 +640,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.CollocateRegistry", false, 0),
     IceInternal::Property("IceGrid.Node.Data", false, 0),
     IceInternal::Property("IceGrid.Node.DisableOnFailure", false, 0),
+    IceInternal::Property("IceGrid.Node.MaxActivations", false, 0),
     IceInternal::Property("IceGrid.Node.Name", false, 0),
     IceInternal::Property("IceGrid.Node.Output", false, 0),
     IceInternal::Property("IceGrid.Node.ProcessorSocketCount", false, 0),
@@ -630,6 +664,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.UserAccountMapper.Context.*", false, 0),
     IceInternal::Property("IceGrid.Node.UserAccountMapper", false, 0),
     IceInternal::Property("IceGrid.Node.WaitTime", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdaptiveTwoChoices", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminCryptPasswords", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.ConnectionCached", false, 0),
@@ -647,7 +682,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ACM.Close", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ACM", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.AdapterId", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.CoalesceReplies", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Endpoints", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.InlineDispatch", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.PreferSecure", false, 0),
@@ -694,7 +731,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Client.ACM.Close", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ACM", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.AdapterId", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.CoalesceReplies", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Endpoints", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.InlineDispatch", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.PreferSecure", false, 0),
@@ -734,7 +773,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Discovery.ACM.Close", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ACM", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.AdapterId", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.CoalesceReplies", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Endpoints", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.InlineDispatch", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.PreferSecure", false, 0),
@@ -776,7 +817,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Internal.ACM.Close", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ACM", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.AdapterId", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.CoalesceReplies", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Endpoints", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.InlineDispatch", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.PreferSecure", false, 0),
@@ -828,7 +871,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Server.ACM.Close", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ACM", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.AdapterId", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.CoalesceReplies", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Endpoints", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.InlineDispatch", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.PreferSecure", false, 0),
@@ -866,7 +911,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.SessionManager.ACM.Close", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ACM", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.AdapterId", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.CoalesceReplies", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Endpoints", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.InlineDispatch", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.PreferSecure", false, 0),
@@ -942,7 +989,9 @@ const IceInternal::Property IcePatch2PropsData[] =
     IceInternal::Property("IcePatch2.ACM.Close", false, 0),
     IceInternal::Property("IcePatch2.ACM", false, 0),
     IceInternal::Property("IcePatch2.AdapterId", false, 0),
+    IceInternal::Property("IcePatch2.CoalesceReplies", false, 0),
     IceInternal::Property("IcePatch2.Endpoints", false, 0),
+    IceInternal::Property("IcePatch2.InlineDispatch", false, 0),
     IceInternal::Property("IcePatch2.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IcePatch2.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IcePatch2.Locator.PreferSecure", false, 0),
@@ -1016,6 +1065,7 @@ const IceInternal::Property IceSSLPropsData[] =
     IceInternal::Property("IceSSL.FindCert.*", true, "IceSSL.FindCert"),
     IceInternal::Property("IceSSL.ImportCert.*", true, 0),
     IceInternal::Property("IceSSL.InitOpenSSL", false, 0),
+    IceInternal::Property("IceSSL.KernelTLS", false, 0),
     IceInternal::Property("IceSSL.KeyFile", true, 0),
     IceInternal::Property("IceSSL.KeySet", true, "IceSSL.CertStoreLocation"),
     IceInternal::Property("IceSSL.Keychain", false, 0),
@@ -1031,6 +1081,8 @@ const IceInternal::Property IceSSLPropsData[] =
     IceInternal::Property("IceSSL.ProtocolVersionMax", false, 0),
     IceInternal::Property("IceSSL.ProtocolVersionMin", false, 0),
     IceInternal::Property("IceSSL.Random", false, 0),
+    IceInternal::Property("IceSSL.SessionCacheSize", false, 0),
+    IceInternal::Property("IceSSL.SessionCacheTimeout", false, 0),
     IceInternal::Property("IceSSL.Trace.Security", false, 0),
     IceInternal::Property("IceSSL.TrustOnly", false, 0),
     IceInternal::Property("IceSSL.TrustOnly.Client", false, 0),
@@ -1067,7 +1119,9 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Client.ACM.Close", false, 0),
     IceInternal::Property("Glacier2.Client.ACM", false, 0),
     IceInternal::Property("Glacier2.Client.AdapterId", false, 0),
+    IceInternal::Property("Glacier2.Client.CoalesceReplies", false, 0),
     IceInternal::Property("Glacier2.Client.Endpoints", false, 0),
+    IceInternal::Property("Glacier2.Client.InlineDispatch", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.EndpointSelection", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.ConnectionCached", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.PreferSecure", false, 0),
@@ -1142,7 +1196,9 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Server.ACM.Close", false, 0),
     IceInternal::Property("Glacier2.Server.ACM", false, 0),
     IceInternal::Property("Glacier2.Server.AdapterId", false, 0),
+    IceInternal::Property("Glacier2.Server.CoalesceReplies", false, 0),
     IceInternal::Property("Glacier2.Server.Endpoints", false, 0),
+    IceInternal::Property("Glacier2.Server.InlineDispatch", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.EndpointSelection", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.ConnectionCached", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.PreferSecure", false, 0),
@@ -1353,7 +1353,7 @@ IceProxy::Ice::Object::ice_getConnection()
         RequestHandlerPtr handler;
         try
         {
-            handler = __getRequestHandler();
+            handler = __getRequestHandler(false);
             return handler->waitForConnection(); // Wait for the connection to be established.
         }
         catch(const IceInternal::RetryException&)
@@ -1613,18 +1613,23 @@ operator<<(ostream& os, const ::IceProxy::Ice::Object& p)
 }
 
 ::IceInternal::RequestHandlerPtr
-IceProxy::Ice::Object::__getRequestHandler()
+IceProxy::Ice::Object::__getRequestHandler(bool select)
 {
+    //
+    // Invocations select the handler to send the request with, the
+    // proxy connection is obtained from the unselected handler.
+    //
     RequestHandlerPtr handler;
     if(_reference->getCacheConnection())
     {
         IceUtil::Mutex::Lock sync(_mutex);
-        if(_requestHandler)
-        {
-            return _requestHandler;
-        }
+        handler = _requestHandler;
+    }
+    if(!handler)
+    {
+        handler = _reference->getRequestHandler(this);
     }
-    return _reference->getRequestHandler(this);
+    return select ? handler->select() : handler;
 }
 
 IceInternal::BatchRequestQueuePtr
@@ -38,3 +38,9 @@ RequestHandler::RequestHandler(const ReferencePtr& reference) :
     _response(reference->getMode() == Reference::ModeTwoway)
 {
 }
+
+RequestHandlerPtr
+RequestHandler::select()
+{
+    return this;
+}
@@ -66,6 +66,12 @@ public:
 
     virtual RequestHandlerPtr update(const RequestHandlerPtr&, const RequestHandlerPtr&) = 0;
 
+    //
+    // Returns the handler to use for the next invocation. This is the
+    // handler itself unless it spreads invocations over other handlers.
+    //
+    virtual RequestHandlerPtr select();
+
     virtual bool sendRequest(ProxyOutgoingBase*) = 0;
     virtual AsyncStatus sendAsyncRequest(const ProxyOutgoingAsyncBasePtr&) = 0;
 
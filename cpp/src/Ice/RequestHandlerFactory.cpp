@@ -10,15 +10,19 @@
 #include <Ice/RequestHandlerFactory.h>
 #include <Ice/CollocatedRequestHandler.h>
 #include <Ice/ConnectRequestHandler.h>
-#include <Ice/CollocatedRequestHandler.h>
+#include <Ice/ConnectionPoolRequestHandler.h>
 #include <Ice/Reference.h>
 #include <Ice/ObjectAdapterFactory.h>
 #include <Ice/Instance.h>
+#include <Ice/Properties.h>
 
 using namespace std;
 using namespace IceInternal;
 
-RequestHandlerFactory::RequestHandlerFactory(const InstancePtr& instance) : _instance(instance)
+RequestHandlerFactory::RequestHandlerFactory(const InstancePtr& instance) :
+    _instance(instance),
+    _connectionPoolSize(instance->initializationData().properties->getPropertyAsIntWithDefault(
+                            "Ice.ConnectionPoolSize", 1))
 {
 }
 
@@ -34,6 +38,48 @@ IceInternal::RequestHandlerFactory::getRequestHandler(const RoutableReferencePtr
         }
     }
 
+    //
+    // Routed references aren't pooled: the router only has a session for
+    // the connection established with the reference's connection ID.
+    //
+    if(_connectionPoolSize > 1 && ref->getCacheConnection() && !ref->getRouterInfo())
+    {
+        //
+        // Use a different connection ID for each pooled handler to get
+        // a distinct connection to the same endpoints.
+        //
+        vector<RequestHandlerPtr> handlers;
+        handlers.push_back(connect(ref, proxy));
+        for(int i = 1; i < _connectionPoolSize; ++i)
+        {
+            ostringstream os;
+            os << ref->getConnectionId() << "-pool" << i;
+            RoutableReferencePtr r = RoutableReferencePtr::dynamicCast(ref->changeConnectionId(os.str()));
+            assert(r);
+            handlers.push_back(connect(r, proxy));
+        }
+        return proxy->__setRequestHandler(new ConnectionPoolRequestHandler(ref, handlers));
+    }
+    return proxy->__setRequestHandler(connect(ref, proxy));
+}
+
+void
+IceInternal::RequestHandlerFactory::removeRequestHandler(const ReferencePtr& ref, const RequestHandlerPtr& handler)
+{
+    if(ref->getCacheConnection())
+    {
+        Lock sync(*this);
+        map<ReferencePtr, ConnectRequestHandlerPtr>::iterator p = _handlers.find(ref);
+        if(p != _handlers.end() && p->second.get() == handler.get())
+        {
+            _handlers.erase(p);
+        }
+    }
+}
+
+RequestHandlerPtr
+IceInternal::RequestHandlerFactory::connect(const RoutableReferencePtr& ref, const Ice::ObjectPrx& proxy)
+{
     ConnectRequestHandlerPtr handler;
     bool connect = false;
     if(ref->getCacheConnection())
@@ -60,19 +106,5 @@ IceInternal::RequestHandlerFactory::getRequestHandler(const RoutableReferencePtr
     {
         ref->getConnection(handler.get());
     }
-    return proxy->__setRequestHandler(handler->connect(proxy));
-}
-
-void
-IceInternal::RequestHandlerFactory::removeRequestHandler(const ReferencePtr& ref, const RequestHandlerPtr& handler)
-{
-    if(ref->getCacheConnection())
-    {
-        Lock sync(*this);
-        map<ReferencePtr, ConnectRequestHandlerPtr>::iterator p = _handlers.find(ref);
-        if(p != _handlers.end() && p->second.get() == handler.get())
-        {
-            _handlers.erase(p);
-        }
-    }
+    return handler->connect(proxy);
 }
@@ -33,7 +33,10 @@ public:
 
 private:
 
+    RequestHandlerPtr connect(const RoutableReferencePtr&, const Ice::ObjectPrx&);
+
     const InstancePtr _instance;
+    const int _connectionPoolSize;
     std::map<ReferencePtr, ConnectRequestHandlerPtr> _handlers;
 };
 
@@ -0,0 +1,774 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Tracer.h>
+#include <Ice/Instance.h>
+#include <Ice/BasicStream.h>
+#include <Ice/Reference.h>
+#include <Ice/ImplicitContextI.h>
+#include <Ice/Properties.h>
+#include <Ice/LoggerUtil.h>
+#include <Ice/LocalException.h>
+#include <IceUtil/Random.h>
+#include <IceUtil/ThreadException.h>
+#include <IceUtil/MutexPtrLock.h>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+IceUtil::Shared* IceInternal::upCast(Tracer* p) { return p; }
+
+extern "C" void iceTracerThreadDestructor(void*);
+
+namespace
+{
+
+//
+// The trace context is sent with the request context using the format
+// of the W3C traceparent header: version, trace ID, parent span ID and
+// flags separated by dashes.
+//
+const string traceContextKey = "traceparent";
+const string::size_type traceContextSize = 55;
+
+Long
+getThreshold(const InitializationData& initData)
+{
+    //
+    // The sample rate is a fraction of the requests, the threshold is
+    // compared against the 32 high-order bits of a random number.
+    //
+    string value = initData.properties->getPropertyWithDefault("Ice.Tracer.SampleRate", "0.01");
+    istringstream is(value);
+    double rate;
+    if(!(is >> rate) || !(is >> ws).eof() || rate < 0 || rate > 1)
+    {
+        Warning out(initData.logger);
+        out << "invalid value for Ice.Tracer.SampleRate: `" << value << "'";
+        rate = 0.01;
+    }
+    return static_cast<Long>(rate * 4294967296.0);
+}
+
+unsigned int
+getCapacity(const PropertiesPtr& properties)
+{
+    //
+    // The capacity of the ring buffers is rounded up to a power of two.
+    //
+    Int size = properties->getPropertyAsIntWithDefault("Ice.Tracer.BufferSize", 256);
+    unsigned int capacity = 1;
+    while(capacity < static_cast<unsigned int>(size) && capacity < (1u << 20))
+    {
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+void
+appendHex(string& s, Long value)
+{
+    static const char digits[] = "0123456789abcdef";
+    for(int shift = 60; shift >= 0; shift -= 4)
+    {
+        s += digits[(value >> shift) & 0xf];
+    }
+}
+
+bool
+parseHex(const string& s, string::size_type pos, string::size_type size, Long& value)
+{
+    unsigned long long v = 0;
+    for(string::size_type i = pos; i < pos + size; ++i)
+    {
+        char c = s[i];
+        int digit;
+        if(c >= '0' && c <= '9')
+        {
+            digit = c - '0';
+        }
+        else if(c >= 'a' && c <= 'f')
+        {
+            digit = c - 'a' + 10;
+        }
+        else
+        {
+            return false;
+        }
+        v = (v << 4) | static_cast<unsigned long long>(digit);
+    }
+    value = static_cast<Long>(v);
+    return true;
+}
+
+bool
+parseTraceContext(const string& value, Long& traceIdHigh, Long& traceIdLow, Long& parentSpanId, bool& sampled)
+{
+    if(value.size() != traceContextSize || value[2] != '-' || value[35] != '-' || value[52] != '-')
+    {
+        return false;
+    }
+
+    Long version;
+    Long flags;
+    if(!parseHex(value, 0, 2, version) || version == 0xff ||
+       !parseHex(value, 3, 16, traceIdHigh) || !parseHex(value, 19, 16, traceIdLow) ||
+       !parseHex(value, 36, 16, parentSpanId) || !parseHex(value, 53, 2, flags))
+    {
+        return false;
+    }
+    if((traceIdHigh == 0 && traceIdLow == 0) || parentSpanId == 0)
+    {
+        return false;
+    }
+    sampled = (flags & 1) != 0;
+    return true;
+}
+
+void
+appendJson(string& s, const string& value)
+{
+    static const char digits[] = "0123456789abcdef";
+    s += '"';
+    for(string::const_iterator p = value.begin(); p != value.end(); ++p)
+    {
+        unsigned char c = static_cast<unsigned char>(*p);
+        if(c == '"' || c == '\\')
+        {
+            s += '\\';
+            s += *p;
+        }
+        else if(c < 0x20)
+        {
+            s += "\\u00";
+            s += digits[c >> 4];
+            s += digits[c & 0xf];
+        }
+        else
+        {
+            s += *p;
+        }
+    }
+    s += '"';
+}
+
+IceUtil::Mutex* staticMutex = 0;
+long nextTracerId = 0;
+
+//
+// The key is shared by the tracers of all the communicators, each thread
+// keeps the states it created for these tracers in a vector. Like the
+// key of the per-thread implicit contexts, the key is never deleted.
+//
+#ifdef _WIN32
+DWORD threadStatesKey;
+#else
+pthread_key_t threadStatesKey;
+#endif
+
+class Init
+{
+public:
+
+    Init()
+    {
+        staticMutex = new IceUtil::Mutex;
+    }
+
+    ~Init()
+    {
+        delete staticMutex;
+        staticMutex = 0;
+    }
+};
+
+Init init;
+
+long
+newTracerId()
+{
+    IceUtilInternal::MutexPtrLock<IceUtil::Mutex> sync(staticMutex);
+    if(nextTracerId == 0)
+    {
+#ifdef _WIN32
+        threadStatesKey = TlsAlloc();
+        if(threadStatesKey == TLS_OUT_OF_INDEXES)
+        {
+            throw IceUtil::ThreadSyscallException(__FILE__, __LINE__, GetLastError());
+        }
+#else
+        int err = pthread_key_create(&threadStatesKey, &iceTracerThreadDestructor);
+        if(err != 0)
+        {
+            throw IceUtil::ThreadSyscallException(__FILE__, __LINE__, err);
+        }
+#endif
+    }
+    return nextTracerId++;
+}
+
+}
+
+class Tracer::ThreadState : public IceUtil::Shared
+{
+public:
+
+    ThreadState(Tracer* t, unsigned int capacity) :
+        traceIdHigh(0),
+        traceIdLow(0),
+        spanId(0),
+        tracer(t),
+        tracerId(t->_id),
+        _capacity(capacity),
+        _writePos(0),
+        _readPos(0)
+    {
+        IceUtilInternal::generateRandom(reinterpret_cast<char*>(&_random), sizeof(_random));
+        if(_random == 0)
+        {
+            _random = 1;
+        }
+    }
+
+    bool
+    sample(Long threshold)
+    {
+        return threshold > 0 && static_cast<Long>(next() >> 32) < threshold;
+    }
+
+    Long
+    nextId()
+    {
+        Long id;
+        do
+        {
+            id = static_cast<Long>(next());
+        }
+        while(id == 0);
+        return id;
+    }
+
+    void
+    record(const IceMX::Span& span)
+    {
+        //
+        // Called by the thread owning the state. The slots are allocated
+        // when the first span is recorded, the consumer doesn't access
+        // them until the head moves.
+        //
+        if(_slots.empty())
+        {
+            _slots.resize(_capacity);
+        }
+        if(_writePos - static_cast<unsigned int>(_tail.load()) >= _capacity)
+        {
+            _dropped.fetch_add(1);
+            return;
+        }
+        _slots[_writePos & (_capacity - 1)] = span;
+        ++_writePos;
+        _head.exchange(static_cast<int>(_writePos));
+    }
+
+    void
+    drain(IceMX::SpanSeq& spans, Long& dropped)
+    {
+        //
+        // Called with the tracer mutex locked.
+        //
+        const unsigned int head = static_cast<unsigned int>(_head.load());
+        for(; _readPos != head; ++_readPos)
+        {
+            spans.push_back(_slots[_readPos & (_capacity - 1)]);
+        }
+        _tail.exchange(static_cast<int>(_readPos));
+        dropped += _dropped.exchange(0);
+    }
+
+    void
+    release()
+    {
+        //
+        // Called with the static mutex locked when the thread exits.
+        //
+        if(tracer)
+        {
+            tracer->release(this);
+        }
+    }
+
+    void
+    detach()
+    {
+        //
+        // Called with the static mutex locked when the tracer is
+        // destroyed. The thread no longer uses the state so its buffer
+        // can be freed, the state itself is freed once the thread exits
+        // or creates a state for another tracer.
+        //
+        tracer = 0;
+        vector<IceMX::Span>().swap(_slots);
+    }
+
+    //
+    // The span of the sampled dispatch of the thread, the trace ID is 0
+    // if the thread isn't dispatching a sampled request.
+    //
+    Long traceIdHigh;
+    Long traceIdLow;
+    Long spanId;
+
+    //
+    // The tracer is cleared with the static mutex locked when it's
+    // destroyed. The recording thread finds its state with the tracer
+    // ID, it's never reused by another tracer.
+    //
+    Tracer* tracer;
+    const long tracerId;
+
+private:
+
+    unsigned long long
+    next()
+    {
+        //
+        // xorshift64*
+        //
+        _random ^= _random >> 12;
+        _random ^= _random << 25;
+        _random ^= _random >> 27;
+        return _random * 2685821657736338717ULL;
+    }
+
+    unsigned long long _random;
+    const unsigned int _capacity;
+    vector<IceMX::Span> _slots;
+    unsigned int _writePos;
+    unsigned int _readPos;
+    IceUtilInternal::Atomic _head;
+    IceUtilInternal::Atomic _tail;
+    IceUtilInternal::Atomic _dropped;
+};
+
+IceInternal::TraceSpan::TraceSpan(const TracerPtr& t) : tracer(t)
+{
+}
+
+IceInternal::Tracer::Tracer(Instance* instance) :
+    _instance(instance),
+    _threshold(getThreshold(instance->initializationData())),
+    _capacity(getCapacity(instance->initializationData().properties)),
+    _file(instance->initializationData().properties->getProperty("Ice.Tracer.File")),
+    _id(newTracerId()),
+    _dropped(0)
+{
+    if(!_file.empty())
+    {
+        _out.open(_file, fstream::out | fstream::app);
+        if(!_out.is_open())
+        {
+            throw InitializationException(__FILE__, __LINE__, "Tracer: cannot open " + _file);
+        }
+    }
+}
+
+IceInternal::Tracer::~Tracer()
+{
+    IceUtilInternal::MutexPtrLock<IceUtil::Mutex> sync(staticMutex);
+    for(ThreadStateSeq::const_iterator p = _threads.begin(); p != _threads.end(); ++p)
+    {
+        (*p)->detach();
+    }
+}
+
+TraceSpan*
+IceInternal::Tracer::startInvocation(const Identity& id, const string& operation)
+{
+    ThreadState* state = getThreadState();
+    TraceSpan* span;
+    if(state->traceIdHigh != 0 || state->traceIdLow != 0)
+    {
+        //
+        // Invocation made by a sampled dispatch.
+        //
+        span = newSpan(state, false);
+        span->span.traceIdHigh = state->traceIdHigh;
+        span->span.traceIdLow = state->traceIdLow;
+        span->span.parentSpanId = state->spanId;
+    }
+    else if(state->sample(_threshold))
+    {
+        span = newSpan(state, false);
+        span->span.traceIdHigh = state->nextId();
+        span->span.traceIdLow = state->nextId();
+    }
+    else
+    {
+        return 0;
+    }
+    span->span.id = id;
+    span->span.operation = operation;
+    return span;
+}
+
+TraceSpan*
+IceInternal::Tracer::startDispatch(const Current& current)
+{
+    ThreadState* state = getThreadState();
+    TraceSpan* span = 0;
+    Context::const_iterator p = current.ctx.find(traceContextKey);
+    Long traceIdHigh;
+    Long traceIdLow;
+    Long parentSpanId;
+    bool sampled;
+    if(p != current.ctx.end() && parseTraceContext(p->second, traceIdHigh, traceIdLow, parentSpanId, sampled))
+    {
+        //
+        // Honor the sampling decision of the caller.
+        //
+        if(!sampled)
+        {
+            return 0;
+        }
+        span = newSpan(state, true);
+        span->span.traceIdHigh = traceIdHigh;
+        span->span.traceIdLow = traceIdLow;
+        span->span.parentSpanId = parentSpanId;
+    }
+    else if(state->sample(_threshold))
+    {
+        span = newSpan(state, true);
+        span->span.traceIdHigh = state->nextId();
+        span->span.traceIdLow = state->nextId();
+    }
+    else
+    {
+        return 0;
+    }
+    span->span.id = current.id;
+    span->span.operation = current.operation;
+    return span;
+}
+
+void
+IceInternal::Tracer::finish(TraceSpan* span)
+{
+    span->span.duration = (IceUtil::Time::now(IceUtil::Time::Monotonic) - span->started).toMicroSeconds();
+    getThreadState()->record(span->span);
+    delete span; // Must be last, the span might hold the last reference to the tracer.
+}
+
+IceMX::SpanSeq
+IceInternal::Tracer::getSpans(Long& dropped)
+{
+    Lock sync(*this);
+    IceMX::SpanSeq spans;
+    spans.swap(_spans);
+    dropped = _dropped;
+    _dropped = 0;
+    for(ThreadStateSeq::const_iterator p = _threads.begin(); p != _threads.end(); ++p)
+    {
+        (*p)->drain(spans, dropped);
+    }
+    return spans;
+}
+
+bool
+IceInternal::Tracer::hasFile() const
+{
+    return !_file.empty();
+}
+
+void
+IceInternal::Tracer::destroy()
+{
+    if(!_file.empty())
+    {
+        exportSpans();
+
+        Lock sync(*this);
+        _out.close();
+    }
+}
+
+void
+IceInternal::Tracer::runTimerTask()
+{
+    exportSpans();
+}
+
+void
+IceInternal::Tracer::writeContext(BasicStream* os, const Context* context, Reference* ref, const TraceSpan& span)
+{
+    Context ctx;
+    if(context != 0)
+    {
+        ctx = *context;
+    }
+    else
+    {
+        const ImplicitContextIPtr& implicitContext = ref->getInstance()->getImplicitContext();
+        const Context& prxContext = ref->getContext()->getValue();
+        if(implicitContext == 0)
+        {
+            ctx = prxContext;
+        }
+        else
+        {
+            implicitContext->combine(prxContext, ctx);
+        }
+    }
+
+    string traceContext;
+    traceContext.reserve(traceContextSize);
+    traceContext += "00-";
+    appendHex(traceContext, span.span.traceIdHigh);
+    appendHex(traceContext, span.span.traceIdLow);
+    traceContext += '-';
+    appendHex(traceContext, span.span.spanId);
+    traceContext += "-01";
+    ctx[traceContextKey] = traceContext;
+
+    os->write(ctx);
+}
+
+#ifdef _WIN32
+void
+IceInternal::Tracer::cleanupThread()
+{
+    if(nextTracerId > 0)
+    {
+        iceTracerThreadDestructor(TlsGetValue(threadStatesKey));
+    }
+}
+#endif
+
+Tracer::ThreadState*
+IceInternal::Tracer::getThreadState()
+{
+#if defined(_WIN32)
+    ThreadStateSeq* states = static_cast<ThreadStateSeq*>(TlsGetValue(threadStatesKey));
+#else
+    ThreadStateSeq* states = static_cast<ThreadStateSeq*>(pthread_getspecific(threadStatesKey));
+#endif
+    if(states)
+    {
+        for(ThreadStateSeq::const_iterator p = states->begin(); p != states->end(); ++p)
+        {
+            if((*p)->tracerId == _id)
+            {
+                return p->get();
+            }
+        }
+    }
+    return newThreadState(states);
+}
+
+Tracer::ThreadState*
+IceInternal::Tracer::newThreadState(ThreadStateSeq* states)
+{
+    IceUtil::Handle<ThreadState> state = new ThreadState(this, _capacity);
+    {
+        IceUtilInternal::MutexPtrLock<IceUtil::Mutex> sync(staticMutex);
+        if(!states)
+        {
+            states = new ThreadStateSeq();
+#if defined(_WIN32)
+            TlsSetValue(threadStatesKey, states);
+#else
+            pthread_setspecific(threadStatesKey, states);
+#endif
+        }
+        else
+        {
+            //
+            // Free the states of the destroyed tracers.
+            //
+            ThreadStateSeq::iterator p = states->begin();
+            while(p != states->end())
+            {
+                if(!(*p)->tracer)
+                {
+                    p = states->erase(p);
+                }
+                else
+                {
+                    ++p;
+                }
+            }
+        }
+        states->push_back(state);
+    }
+
+    Lock sync(*this);
+    _threads.push_back(state);
+    return state.get();
+}
+
+void
+IceInternal::Tracer::release(ThreadState* state)
+{
+    //
+    // Called with the static mutex locked when the thread of the state
+    // exits. Its spans are kept until they're retrieved, up to the
+    // capacity of a thread buffer.
+    //
+    Lock sync(*this);
+    IceMX::SpanSeq spans;
+    state->drain(spans, _dropped);
+    for(IceMX::SpanSeq::const_iterator p = spans.begin(); p != spans.end(); ++p)
+    {
+        if(_spans.size() < _capacity)
+        {
+            _spans.push_back(*p);
+        }
+        else
+        {
+            ++_dropped;
+        }
+    }
+    for(ThreadStateSeq::iterator p = _threads.begin(); p != _threads.end(); ++p)
+    {
+        if(p->get() == state)
+        {
+            _threads.erase(p);
+            break;
+        }
+    }
+}
+
+TraceSpan*
+IceInternal::Tracer::newSpan(ThreadState* state, bool dispatch)
+{
+    TraceSpan* span = new TraceSpan(this);
+    span->span.spanId = state->nextId();
+    span->span.parentSpanId = 0;
+    span->span.dispatch = dispatch;
+    span->span.start = IceUtil::Time::now().toMicroSeconds();
+    span->span.duration = 0;
+    span->span.userException = false;
+    span->started = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    return span;
+}
+
+void
+IceInternal::Tracer::exportSpans()
+{
+    //
+    // Each span is written as a JSON object on its own line.
+    //
+    Long dropped;
+    IceMX::SpanSeq spans = getSpans(dropped);
+    if(dropped > 0)
+    {
+        Warning out(_instance->initializationData().logger);
+        out << "Tracer: " << dropped << " spans were dropped, consider increasing Ice.Tracer.BufferSize";
+    }
+    if(spans.empty())
+    {
+        return;
+    }
+
+    string s;
+    for(IceMX::SpanSeq::const_iterator p = spans.begin(); p != spans.end(); ++p)
+    {
+        s += "{\"traceId\":\"";
+        appendHex(s, p->traceIdHigh);
+        appendHex(s, p->traceIdLow);
+        s += "\",\"spanId\":\"";
+        appendHex(s, p->spanId);
+        s += '"';
+        if(p->parentSpanId != 0)
+        {
+            s += ",\"parentSpanId\":\"";
+            appendHex(s, p->parentSpanId);
+            s += '"';
+        }
+        s += p->dispatch ? ",\"kind\":\"dispatch\",\"id\":" : ",\"kind\":\"invocation\",\"id\":";
+        appendJson(s, _instance->identityToString(p->id));
+        s += ",\"operation\":";
+        appendJson(s, p->operation);
+        ostringstream os;
+        os << ",\"start\":" << p->start << ",\"duration\":" << p->duration;
+        s += os.str();
+        if(p->userException)
+        {
+            s += ",\"userException\":true";
+        }
+        if(!p->failure.empty())
+        {
+            s += ",\"failure\":";
+            appendJson(s, p->failure);
+        }
+        s += "}\n";
+    }
+
+    Lock sync(*this);
+    if(_out.is_open())
+    {
+        _out << s;
+        _out.flush();
+    }
+}
+
+IceInternal::TracerAdminI::TracerAdminI(const TracerPtr& tracer) : _tracer(tracer)
+{
+}
+
+IceMX::SpanSeq
+IceInternal::TracerAdminI::getSpans(Long& dropped, const Current&)
+{
+    return _tracer->getSpans(dropped);
+}
+
+IceInternal::Tracer::DispatchScope::DispatchScope(const TraceSpan* span) : _state(0)
+{
+    if(span)
+    {
+        _state = span->tracer->getThreadState();
+        _traceIdHigh = _state->traceIdHigh;
+        _traceIdLow = _state->traceIdLow;
+        _spanId = _state->spanId;
+        _state->traceIdHigh = span->span.traceIdHigh;
+        _state->traceIdLow = span->span.traceIdLow;
+        _state->spanId = span->span.spanId;
+    }
+}
+
+IceInternal::Tracer::DispatchScope::~DispatchScope()
+{
+    if(_state)
+    {
+        _state->traceIdHigh = _traceIdHigh;
+        _state->traceIdLow = _traceIdLow;
+        _state->spanId = _spanId;
+    }
+}
+
+extern "C" void
+iceTracerThreadDestructor(void* v)
+{
+    Tracer::ThreadStateSeq* states = static_cast<Tracer::ThreadStateSeq*>(v);
+    if(states != 0)
+    {
+        {
+            //
+            // The static mutex prevents the tracers of the states from
+            // being destroyed while the states are released.
+            //
+            IceUtilInternal::MutexPtrLock<IceUtil::Mutex> sync(staticMutex);
+            for(Tracer::ThreadStateSeq::const_iterator p = states->begin(); p != states->end(); ++p)
+            {
+                (*p)->release();
+            }
+        }
+        delete states;
+    }
+}
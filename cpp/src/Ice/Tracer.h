@@ -0,0 +1,146 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_TRACER_H
+#define ICE_TRACER_H
+
+#include <IceUtil/Mutex.h>
+#include <IceUtil/Timer.h>
+#include <IceUtil/Atomic.h>
+#include <IceUtil/FileUtil.h>
+#include <Ice/TracerF.h>
+#include <Ice/InstanceF.h>
+#include <Ice/ReferenceF.h>
+#include <Ice/Metrics.h>
+
+namespace IceInternal
+{
+
+class BasicStream;
+
+//
+// A sampled invocation or dispatch. The span is allocated by the
+// tracer when the invocation or dispatch is sampled and it's recorded
+// and deleted when the invocation or dispatch completes.
+//
+class TraceSpan
+{
+public:
+
+    TraceSpan(const TracerPtr&);
+
+    const TracerPtr tracer;
+    IceMX::Span span;
+    IceUtil::Time started;
+};
+
+//
+// The request tracer samples invocations and dispatches and records
+// their spans. The trace context of a sampled invocation is sent with
+// the request context and the dispatch of a request with a trace
+// context is recorded as a child span of the invocation. Invocations
+// made by the thread of a sampled dispatch are recorded as child spans
+// of the dispatch.
+//
+// Each thread records the spans in its own ring buffer. The buffer is
+// a single-producer, single-consumer queue: spans are added without
+// locking by the recording thread and removed with the tracer mutex
+// locked by the admin facet or the file exporter. Spans are dropped if
+// the buffer of the recording thread is full. The state of a thread is
+// released when the thread exits, the spans it didn't export yet are
+// moved to the tracer.
+//
+class Tracer : public IceUtil::TimerTask, private IceUtil::Mutex
+{
+public:
+
+    class ThreadState;
+    typedef std::vector<IceUtil::Handle<ThreadState> > ThreadStateSeq;
+
+    Tracer(Instance*);
+    virtual ~Tracer();
+
+    TraceSpan* startInvocation(const Ice::Identity&, const std::string&);
+    TraceSpan* startDispatch(const Ice::Current&);
+    void finish(TraceSpan*);
+
+    IceMX::SpanSeq getSpans(Ice::Long&);
+
+    bool hasFile() const;
+    void destroy();
+
+    virtual void runTimerTask();
+
+    static void writeContext(BasicStream*, const Ice::Context*, Reference*, const TraceSpan&);
+
+#ifdef _WIN32
+    static void cleanupThread();
+#endif
+
+    //
+    // Makes the span of a dispatch the parent of the invocations made by
+    // the calling thread for the lifetime of the scope.
+    //
+    class DispatchScope
+    {
+    public:
+
+        DispatchScope(const TraceSpan*);
+        ~DispatchScope();
+
+    private:
+
+        ThreadState* _state;
+        Ice::Long _traceIdHigh;
+        Ice::Long _traceIdLow;
+        Ice::Long _spanId;
+    };
+
+private:
+
+    friend class DispatchScope;
+
+    ThreadState* getThreadState();
+    ThreadState* newThreadState(ThreadStateSeq*);
+    void release(ThreadState*);
+    TraceSpan* newSpan(ThreadState*, bool);
+    void exportSpans();
+
+    Instance* _instance;
+    const Ice::Long _threshold;
+    const unsigned int _capacity;
+    const std::string _file;
+    IceUtilInternal::ofstream _out;
+    const long _id;
+
+    //
+    // The states of the live threads which used the tracer and the spans
+    // of the exited threads which weren't retrieved yet.
+    //
+    ThreadStateSeq _threads;
+    IceMX::SpanSeq _spans;
+    Ice::Long _dropped;
+};
+
+class TracerAdminI : public IceMX::TracerAdmin
+{
+public:
+
+    TracerAdminI(const TracerPtr&);
+
+    virtual IceMX::SpanSeq getSpans(Ice::Long&, const Ice::Current&);
+
+private:
+
+    const TracerPtr _tracer;
+};
+
+}
+
+#endif
@@ -0,0 +1,24 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_TRACER_F_H
+#define ICE_TRACER_F_H
+
+#include <Ice/Handle.h>
+
+namespace IceInternal
+{
+
+class Tracer;
+IceUtil::Shared* upCast(Tracer*);
+typedef Handle<Tracer> TracerPtr;
+
+}
+
+#endif
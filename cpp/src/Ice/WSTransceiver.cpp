@@ -17,6 +17,8 @@
 #include <Ice/Buffer.h>
 #include <Ice/LocalException.h>
 #include <Ice/Base64.h>
+#include <Ice/Protocol.h>
+#include <Ice/Properties.h>
 #include <IceUtil/Random.h>
 #include <IceUtil/SHA1.h>
 #include <IceUtil/StringUtil.h>
@@ -31,6 +33,11 @@ typedef unsigned short uint16_t;
 #endif
 
 #include <climits>
+#include <set>
+
+#ifdef ICE_HAS_ZLIB
+#  include <zlib.h>
+#endif
 
 using namespace std;
 using namespace Ice;
@@ -56,6 +63,7 @@ using namespace IceInternal;
 #define OP_RES_0xE  0xE     // Reserved
 #define OP_RES_0xF  0xF     // Reserved
 #define FLAG_FINAL  0x80    // Last frame
+#define FLAG_RSV1   0x40    // Compressed message (permessage-deflate)
 #define FLAG_MASKED 0x80    // Payload is masked
 
 #define CLOSURE_NORMAL         1000
@@ -68,6 +76,101 @@ namespace
 
 const string _iceProtocol = "ice.zeroc.com";
 const string _wsUUID = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+const string _deflateExtension = "permessage-deflate";
+
+//
+// The extension is never offered or accepted if Ice is built without zlib.
+//
+#ifdef ICE_HAS_ZLIB
+const bool _deflateSupported = true;
+#else
+const bool _deflateSupported = false;
+#endif
+
+//
+// The 4 bytes a permessage-deflate sender strips from the end of the
+// compressed data, they must be appended again before inflating.
+//
+const Byte _deflateTrailer[] = { 0x00, 0x00, 0xff, 0xff };
+
+typedef vector<pair<string, string> > ExtensionParams;
+
+//
+// Parses a Sec-WebSocket-Extensions value. Each element of the returned
+// vector holds the extension name (first pair) followed by its parameters.
+//
+vector<ExtensionParams>
+parseExtensions(const string& value)
+{
+    vector<ExtensionParams> extensions;
+    vector<string> elements;
+    if(!IceUtilInternal::splitString(value, ",", elements))
+    {
+        throw WebSocketException("invalid value `" + value + "' for WebSocket extensions");
+    }
+    for(vector<string>::const_iterator p = elements.begin(); p != elements.end(); ++p)
+    {
+        vector<string> tokens;
+        IceUtilInternal::splitString(*p, ";", tokens);
+        ExtensionParams params;
+        for(vector<string>::const_iterator q = tokens.begin(); q != tokens.end(); ++q)
+        {
+            string::size_type pos = q->find('=');
+            string name = IceUtilInternal::trim(q->substr(0, pos));
+            string val = pos == string::npos ? string() : IceUtilInternal::trim(q->substr(pos + 1));
+            if(!name.empty())
+            {
+                params.push_back(make_pair(name, val));
+            }
+        }
+        if(!params.empty())
+        {
+            extensions.push_back(params);
+        }
+    }
+    return extensions;
+}
+
+bool
+parseWindowBits(const string& value, int& bits)
+{
+    if(value.empty() || value.size() > 2 || value.find_first_not_of("0123456789") != string::npos)
+    {
+        return false;
+    }
+    bits = atoi(value.c_str());
+    return bits >= 8 && bits <= 15;
+}
+
+//
+// Applies the 32-bit frame mask to count bytes of the payload starting at
+// the given payload offset. The mask is applied one machine word at a
+// time, dest and src can be the same buffer.
+//
+void
+applyMask(Byte* dest, const Byte* src, size_t count, const Byte* mask, size_t offset)
+{
+    Byte wordMask[sizeof(size_t)];
+    for(size_t i = 0; i < sizeof(size_t); ++i)
+    {
+        wordMask[i] = mask[(offset + i) % 4];
+    }
+    size_t m;
+    memcpy(&m, wordMask, sizeof(size_t));
+
+    size_t i = 0;
+    for(; i + sizeof(size_t) <= count; i += sizeof(size_t))
+    {
+        size_t w;
+        memcpy(&w, src + i, sizeof(size_t));
+        w ^= m;
+        memcpy(dest + i, &w, sizeof(size_t));
+    }
+    for(; i < count; ++i)
+    {
+        dest[i] = src[i] ^ mask[(offset + i) % 4];
+    }
+}
 
 //
 // Rename to avoid conflict with OS 10.10 htonll
@@ -242,8 +345,14 @@ IceInternal::WSTransceiver::initialize(Buffer& readBuffer, Buffer& writeBuffer,
                     << "Upgrade: websocket\r\n"
                     << "Connection: Upgrade\r\n"
                     << "Sec-WebSocket-Protocol: " << _iceProtocol << "\r\n"
-                    << "Sec-WebSocket-Version: 13\r\n"
-                    << "Sec-WebSocket-Key: ";
+                    << "Sec-WebSocket-Version: 13\r\n";
+
+                string offer = getDeflateOffer();
+                if(!offer.empty())
+                {
+                    out << "Sec-WebSocket-Extensions: " << offer << "\r\n";
+                }
+                out << "Sec-WebSocket-Key: ";
 
                 //
                 // The value for Sec-WebSocket-Key is a 16-byte random number,
@@ -361,6 +470,21 @@ IceInternal::WSTransceiver::initialize(Buffer& readBuffer, Buffer& writeBuffer,
                             return s;
                         }
                     }
+
+                    //
+                    // The response to a plain HTTP request is sent, close
+                    // the connection.
+                    //
+                    if(_httpRequest)
+                    {
+                        if(_instance->traceLevel() >= 1)
+                        {
+                            Trace out(_instance->logger(), _instance->traceCategory());
+                            out << "served " << protocol() << " connection HTTP request for `" << _parser->uri()
+                                << "'\n" << toString();
+                        }
+                        throw CloseConnectionException(__FILE__, __LINE__);
+                    }
                 }
                 else
                 {
@@ -390,7 +514,7 @@ IceInternal::WSTransceiver::initialize(Buffer& readBuffer, Buffer& writeBuffer,
     }
     catch(const Ice::LocalException& ex)
     {
-        if(_instance->traceLevel() >= 2)
+        if(_instance->traceLevel() >= 2 && !_httpRequest)
         {
             Trace out(_instance->logger(), _instance->traceCategory());
             out << protocol() << " connection HTTP upgrade request failed\n" << toString() << "\n" << ex;
@@ -566,7 +690,7 @@ IceInternal::WSTransceiver::read(Buffer& buf, bool& hasMoreData)
     //
     if(buf.i == buf.b.end())
     {
-        hasMoreData |= _readI < _readBuffer.i;
+        hasMoreData |= _readI < _readBuffer.i || _readState == ReadStateCompressedPayload;
         return SocketOperationNone;
     }
 
@@ -611,7 +735,7 @@ IceInternal::WSTransceiver::read(Buffer& buf, bool& hasMoreData)
 
     if(buf.i == buf.b.end())
     {
-        hasMoreData |= _readI < _readBuffer.i;
+        hasMoreData |= _readI < _readBuffer.i || _readState == ReadStateCompressedPayload;
         s = SocketOperationNone;
     }
     else
@@ -819,6 +943,13 @@ IceInternal::WSTransceiver::setBufferSize(int rcvSize, int sndSize)
     _delegate->setBufferSize(rcvSize, sndSize);
 }
 
+void
+IceInternal::WSTransceiver::setHttpRequestHandler(const HttpRequestHandlerPtr& handler)
+{
+    assert(_incoming);
+    _httpHandler = handler;
+}
+
 IceInternal::WSTransceiver::WSTransceiver(const ProtocolInstancePtr& instance, const TransceiverPtr& del,
                                           const string& host, int port, const string& resource) :
     _instance(instance),
@@ -829,6 +960,7 @@ IceInternal::WSTransceiver::WSTransceiver(const ProtocolInstancePtr& instance, c
     _incoming(false),
     _state(StateInitializeDelegate),
     _parser(new HttpParser),
+    _httpRequest(false),
     _readState(ReadStateOpcode),
     _readBufferSize(1024),
     _readLastFrame(true),
@@ -840,7 +972,18 @@ IceInternal::WSTransceiver::WSTransceiver(const ProtocolInstancePtr& instance, c
     _readPending(false),
     _writePending(false),
     _closingInitiator(false),
-    _closingReason(CLOSURE_NORMAL)
+    _closingReason(CLOSURE_NORMAL),
+    _perMessageDeflate(_deflateSupported &&
+                       instance->properties()->getPropertyAsInt("Ice.WS.PerMessageDeflate") > 0),
+    _noContextTakeover(instance->properties()->getPropertyAsInt("Ice.WS.PerMessageDeflate.NoContextTakeover") > 0),
+    _deflateThreshold(instance->properties()->getPropertyAsIntWithDefault("Ice.WS.PerMessageDeflate.Threshold", 256)),
+    _deflateNoContextTakeover(false),
+    _deflateStream(0),
+    _inflateStream(0),
+    _readCompressed(false),
+    _readCompressedOffset(0),
+    _readUnmasked(0),
+    _readTrailerPos(0)
 {
     //
     // Use 1KB read and 16KB write buffer sizes. We use 16KB for the
@@ -858,6 +1001,7 @@ IceInternal::WSTransceiver::WSTransceiver(const ProtocolInstancePtr& instance, c
     _incoming(true),
     _state(StateInitializeDelegate),
     _parser(new HttpParser),
+    _httpRequest(false),
     _readState(ReadStateOpcode),
     _readBufferSize(1024),
     _readLastFrame(true),
@@ -869,7 +1013,18 @@ IceInternal::WSTransceiver::WSTransceiver(const ProtocolInstancePtr& instance, c
     _readPending(false),
     _writePending(false),
     _closingInitiator(false),
-    _closingReason(CLOSURE_NORMAL)
+    _closingReason(CLOSURE_NORMAL),
+    _perMessageDeflate(_deflateSupported &&
+                       instance->properties()->getPropertyAsInt("Ice.WS.PerMessageDeflate") > 0),
+    _noContextTakeover(instance->properties()->getPropertyAsInt("Ice.WS.PerMessageDeflate.NoContextTakeover") > 0),
+    _deflateThreshold(instance->properties()->getPropertyAsIntWithDefault("Ice.WS.PerMessageDeflate.Threshold", 256)),
+    _deflateNoContextTakeover(false),
+    _deflateStream(0),
+    _inflateStream(0),
+    _readCompressed(false),
+    _readCompressedOffset(0),
+    _readUnmasked(0),
+    _readTrailerPos(0)
 {
     //
     // Use 1KB read and write buffer sizes.
@@ -878,6 +1033,18 @@ IceInternal::WSTransceiver::WSTransceiver(const ProtocolInstancePtr& instance, c
 
 IceInternal::WSTransceiver::~WSTransceiver()
 {
+#ifdef ICE_HAS_ZLIB
+    if(_deflateStream)
+    {
+        deflateEnd(_deflateStream);
+        delete _deflateStream;
+    }
+    if(_inflateStream)
+    {
+        inflateEnd(_inflateStream);
+        delete _inflateStream;
+    }
+#endif
 }
 
 void
@@ -893,6 +1060,16 @@ IceInternal::WSTransceiver::handleRequest(Buffer& responseBuffer)
         throw WebSocketException("unsupported HTTP version");
     }
 
+    //
+    // Requests without an Upgrade field are passed to the HTTP request
+    // handler if one is set.
+    //
+    if(_httpHandler && !_parser->getHeader("Upgrade", val, true))
+    {
+        handleHttpRequest(responseBuffer);
+        return;
+    }
+
     //
     // "An |Upgrade| header field containing the value 'websocket',
     //  treated as an ASCII case-insensitive value."
@@ -970,6 +1147,19 @@ IceInternal::WSTransceiver::handleRequest(Buffer& responseBuffer)
         throw WebSocketException("invalid value `" + key + "' for WebSocket key");
     }
 
+    //
+    // "Optionally, a |Sec-WebSocket-Extensions| header field, with a
+    //  list of values indicating which extensions the client would like
+    //  to speak."
+    //
+    // We only support permessage-deflate, other extensions are ignored.
+    //
+    string extensions;
+    if(_parser->getHeader("Sec-WebSocket-Extensions", val, true))
+    {
+        extensions = acceptDeflateOffer(val);
+    }
+
     //
     // Retain the target resource.
     //
@@ -986,6 +1176,10 @@ IceInternal::WSTransceiver::handleRequest(Buffer& responseBuffer)
     {
         out << "Sec-WebSocket-Protocol: " << _iceProtocol << "\r\n";
     }
+    if(!extensions.empty())
+    {
+        out << "Sec-WebSocket-Extensions: " << extensions << "\r\n";
+    }
 
     //
     // The response includes:
@@ -1009,6 +1203,41 @@ IceInternal::WSTransceiver::handleRequest(Buffer& responseBuffer)
     responseBuffer.i = responseBuffer.b.begin();
 }
 
+void
+IceInternal::WSTransceiver::handleHttpRequest(Buffer& responseBuffer)
+{
+    string contentType;
+    string body;
+    ostringstream out;
+    if(_parser->method() != "GET")
+    {
+        out << "HTTP/1.1 405 Method Not Allowed\r\n"
+            << "Allow: GET\r\n";
+    }
+    else if(!_httpHandler->handleRequest(*_parser, contentType, body))
+    {
+        out << "HTTP/1.1 404 Not Found\r\n";
+    }
+    else
+    {
+        out << "HTTP/1.1 200 OK\r\n"
+            << "Content-Type: " << contentType << "\r\n";
+    }
+    out << "Content-Length: " << body.size() << "\r\n"
+        << "Connection: close\r\n"
+        << "\r\n"; // EOM
+
+    string str = out.str();
+    responseBuffer.b.resize(str.size() + body.size());
+    memcpy(&responseBuffer.b[0], str.c_str(), str.size());
+    if(!body.empty())
+    {
+        memcpy(&responseBuffer.b[0] + str.size(), body.c_str(), body.size());
+    }
+    responseBuffer.i = responseBuffer.b.begin();
+    _httpRequest = true;
+}
+
 void
 IceInternal::WSTransceiver::handleResponse()
 {
@@ -1103,6 +1332,18 @@ IceInternal::WSTransceiver::handleResponse()
     {
         throw WebSocketException("invalid value `" + val + "' for Sec-WebSocket-Accept");
     }
+
+    //
+    // "If the response includes a |Sec-WebSocket-Extensions| header
+    //  field and this header field indicates the use of an extension
+    //  that was not present in the client's handshake (the server has
+    //  indicated an extension not requested by the client), the client
+    //  MUST _Fail the WebSocket Connection_."
+    //
+    if(_parser->getHeader("Sec-WebSocket-Extensions", val, true))
+    {
+        checkDeflateResponse(val);
+    }
 }
 
 bool
@@ -1128,6 +1369,15 @@ IceInternal::WSTransceiver::preRead(Buffer& buf)
             unsigned char ch = static_cast<unsigned char>(*_readI++);
             _readOpCode = ch & 0xf;
 
+            //
+            // The RSV1 bit marks the first frame of a message compressed
+            // with the permessage-deflate extension.
+            //
+            if((ch & FLAG_RSV1) == FLAG_RSV1 && (!_inflateStream || _readOpCode != OP_DATA))
+            {
+                throw ProtocolException(__FILE__, __LINE__, "invalid RSV1 bit");
+            }
+
             //
             // Remember if last frame if we're going to read a data or
             // continuation frame, this is only for protocol
@@ -1140,6 +1390,7 @@ IceInternal::WSTransceiver::preRead(Buffer& buf)
                     throw ProtocolException(__FILE__, __LINE__, "invalid data frame, no FIN on previous frame");
                 }
                 _readLastFrame = (ch & FLAG_FINAL) == FLAG_FINAL;
+                _readCompressed = (ch & FLAG_RSV1) == FLAG_RSV1;
             }
             else if(_readOpCode == OP_CONT)
             {
@@ -1250,6 +1501,14 @@ IceInternal::WSTransceiver::preRead(Buffer& buf)
                 {
                     throw ProtocolException(__FILE__, __LINE__, "payload length is 0");
                 }
+                if(_readCompressed)
+                {
+                    _readState = ReadStateCompressedPayload;
+                    _readCompressedOffset = 0;
+                    _readUnmasked = 0;
+                    _readTrailerPos = 0;
+                    break;
+                }
                 _readState = ReadStatePayload;
                 assert(buf.i != buf.b.end());
                 _readFrameStart = buf.i;
@@ -1357,6 +1616,66 @@ IceInternal::WSTransceiver::preRead(Buffer& buf)
             _readState = ReadStateOpcode;
         }
 
+        if(_readState == ReadStateCompressedPayload)
+        {
+            //
+            // Inflate the payload directly into the message buffer. The
+            // connection reads the message header first and checks the
+            // message size before enlarging the buffer, so the inflated
+            // data never exceeds the connection's message size limit.
+            //
+            if(buf.b.empty() || buf.i == buf.b.end())
+            {
+                _readStart = _readBuffer.i;
+                return false;
+            }
+
+            if(_readPayloadLength > 0)
+            {
+                if(!readBuffered(1))
+                {
+                    return true;
+                }
+
+                //
+                // Unmask the compressed data that was read since the last
+                // call, some of it might still be pending in the inflater.
+                //
+                size_t available = min(static_cast<size_t>(_readBuffer.i - _readI), _readPayloadLength);
+                if(_incoming && available > _readUnmasked)
+                {
+                    applyMask(_readI + _readUnmasked, _readI + _readUnmasked, available - _readUnmasked, _readMask,
+                              _readCompressedOffset + _readUnmasked);
+                    _readUnmasked = available;
+                }
+
+                size_t n = inflatePayload(buf, _readI, available);
+                _readI += n;
+                _readPayloadLength -= n;
+                _readCompressedOffset += n;
+                _readUnmasked = _incoming ? _readUnmasked - n : 0;
+            }
+            else if(_readLastFrame)
+            {
+                _readTrailerPos += inflatePayload(buf, _deflateTrailer + _readTrailerPos,
+                                                  sizeof(_deflateTrailer) - _readTrailerPos);
+            }
+            else
+            {
+                inflatePayload(buf, _deflateTrailer, 0); // Flush pending output
+            }
+
+            //
+            // If the message buffer isn't full, the inflater consumed all the
+            // input and flushed its output.
+            //
+            if(buf.i < buf.b.end() && _readPayloadLength == 0 &&
+               (!_readLastFrame || _readTrailerPos == sizeof(_deflateTrailer)))
+            {
+                _readState = ReadStateOpcode;
+            }
+        }
+
         if(_readState == ReadStatePayload)
         {
             //
@@ -1410,11 +1729,7 @@ IceInternal::WSTransceiver::postRead(Buffer& buf)
         //
         // Unmask the data we just read.
         //
-        IceInternal::Buffer::Container::iterator p = _readStart;
-        for(size_t n = _readStart - _readFrameStart; p < buf.i; ++p, ++n)
-        {
-            *p ^= _readMask[n % 4];
-        }
+        applyMask(_readStart, _readStart, buf.i - _readStart, _readMask, _readStart - _readFrameStart);
     }
 
     _readPayloadLength -= buf.i - _readStart;
@@ -1442,9 +1757,37 @@ IceInternal::WSTransceiver::preWrite(Buffer& buf)
             }
 
             assert(buf.i = buf.b.begin());
-            prepareWriteHeader(OP_DATA, buf.b.size());
+            if(useDeflate(buf))
+            {
+                //
+                // The compressed message is sent as a single frame from
+                // the internal buffer, masked if necessary.
+                //
+                size_t n = deflateMessage(buf);
+                prepareWriteHeader(OP_DATA, n);
+                _writeBuffer.b[0] |= FLAG_RSV1;
+
+                size_t pos = _writeBuffer.i - _writeBuffer.b.begin();
+                _writeBuffer.b.resize(pos + n);
+                _writeBuffer.i = _writeBuffer.b.begin() + pos;
+                if(!_incoming)
+                {
+                    applyMask(_writeBuffer.i, &_deflateBuffer[0], n, _writeMask, 0);
+                }
+                else
+                {
+                    memcpy(_writeBuffer.i, &_deflateBuffer[0], n);
+                }
+                _writeBuffer.i = _writeBuffer.b.begin();
 
-            _writeState = WriteStatePayload;
+                _writeState = WriteStateCompressedPayload;
+            }
+            else
+            {
+                prepareWriteHeader(OP_DATA, buf.b.size());
+
+                _writeState = WriteStatePayload;
+            }
         }
         else if(_state == StatePingPending)
         {
@@ -1463,7 +1806,14 @@ IceInternal::WSTransceiver::preWrite(Buffer& buf)
                 _writeBuffer.b.resize(pos + _pingPayload.size());
                 _writeBuffer.i = _writeBuffer.b.begin() + pos;
             }
-            memcpy(_writeBuffer.i, &_pingPayload[0], _pingPayload.size());
+            if(!_incoming)
+            {
+                applyMask(_writeBuffer.i, &_pingPayload[0], _pingPayload.size(), _writeMask, 0);
+            }
+            else
+            {
+                memcpy(_writeBuffer.i, &_pingPayload[0], _pingPayload.size());
+            }
             _writeBuffer.i += _pingPayload.size();
             _pingPayload.clear();
 
@@ -1520,11 +1870,10 @@ IceInternal::WSTransceiver::preWrite(Buffer& buf)
             }
 
             size_t n = buf.i - buf.b.begin();
-            for(; n < buf.b.size() && _writeBuffer.i < _writeBuffer.b.end(); ++_writeBuffer.i, ++n)
-            {
-                *_writeBuffer.i = buf.b[n] ^ _writeMask[n % 4];
-            }
-            _writePayloadLength = n;
+            size_t count = min(buf.b.size() - n, static_cast<size_t>(_writeBuffer.b.end() - _writeBuffer.i));
+            applyMask(_writeBuffer.i, &buf.b[n], count, _writeMask, n);
+            _writeBuffer.i += count;
+            _writePayloadLength = n + count;
             if(_writeBuffer.i < _writeBuffer.b.end())
             {
                 _writeBuffer.b.resize(_writeBuffer.i - _writeBuffer.b.begin());
@@ -1612,6 +1961,15 @@ IceInternal::WSTransceiver::postWrite(Buffer& buf)
         }
     }
 
+    if(_writeState == WriteStateCompressedPayload)
+    {
+        if(_writeBuffer.i < _writeBuffer.b.end())
+        {
+            return true;
+        }
+        buf.i = buf.b.end(); // The compressed frame holds the entire message.
+    }
+
     if((!_incoming || buf.i == buf.b.begin()) && _writePayloadLength > 0)
     {
         if(_writeBuffer.i == _writeBuffer.b.end())
@@ -1722,3 +2080,294 @@ IceInternal::WSTransceiver::prepareWriteHeader(Byte opCode, IceInternal::Buffer:
         _writeBuffer.i += sizeof(_writeMask);
     }
 }
+
+string
+IceInternal::WSTransceiver::getDeflateOffer() const
+{
+#ifdef ICE_HAS_ZLIB
+    if(_perMessageDeflate)
+    {
+        //
+        // We don't restrict the window size of the server, so we don't send
+        // server_max_window_bits and we don't advertise client_max_window_bits
+        // since we always compress with the default window size.
+        //
+        string offer = _deflateExtension;
+        if(_noContextTakeover)
+        {
+            offer += "; client_no_context_takeover; server_no_context_takeover";
+        }
+        return offer;
+    }
+#endif
+    return string();
+}
+
+string
+IceInternal::WSTransceiver::acceptDeflateOffer(const string& value)
+{
+#ifdef ICE_HAS_ZLIB
+    if(!_perMessageDeflate)
+    {
+        return string();
+    }
+
+    //
+    // The client lists its offers by order of preference, accept the first
+    // permessage-deflate offer with parameters we support.
+    //
+    vector<ExtensionParams> extensions = parseExtensions(value);
+    for(vector<ExtensionParams>::const_iterator p = extensions.begin(); p != extensions.end(); ++p)
+    {
+        if(p->front().first != _deflateExtension)
+        {
+            continue;
+        }
+
+        bool serverNoContextTakeover = _noContextTakeover;
+        bool clientNoContextTakeover = _noContextTakeover;
+        int windowBits = 15;
+        bool valid = true;
+        set<string> seen;
+        for(ExtensionParams::const_iterator q = p->begin() + 1; q != p->end() && valid; ++q)
+        {
+            if(!seen.insert(q->first).second)
+            {
+                valid = false; // Duplicate parameter
+            }
+            else if(q->first == "server_no_context_takeover")
+            {
+                serverNoContextTakeover = true;
+                valid = q->second.empty();
+            }
+            else if(q->first == "client_no_context_takeover")
+            {
+                clientNoContextTakeover = true;
+                valid = q->second.empty();
+            }
+            else if(q->first == "server_max_window_bits")
+            {
+                //
+                // zlib doesn't support raw deflate streams with a 256-byte
+                // window, decline such offers.
+                //
+                valid = parseWindowBits(q->second, windowBits) && windowBits > 8;
+            }
+            else if(q->first == "client_max_window_bits")
+            {
+                //
+                // The client can compress with any window size, we always
+                // inflate with the largest window.
+                //
+                int bits;
+                valid = q->second.empty() || parseWindowBits(q->second, bits);
+            }
+            else
+            {
+                valid = false;
+            }
+        }
+        if(!valid)
+        {
+            continue;
+        }
+
+        initDeflate(windowBits);
+        _deflateNoContextTakeover = serverNoContextTakeover;
+
+        ostringstream os;
+        os << _deflateExtension;
+        if(serverNoContextTakeover)
+        {
+            os << "; server_no_context_takeover";
+        }
+        if(clientNoContextTakeover)
+        {
+            os << "; client_no_context_takeover";
+        }
+        if(windowBits < 15)
+        {
+            os << "; server_max_window_bits=" << windowBits;
+        }
+        return os.str();
+    }
+#endif
+    return string();
+}
+
+void
+IceInternal::WSTransceiver::checkDeflateResponse(const string& value)
+{
+    vector<ExtensionParams> extensions = parseExtensions(value);
+    if(extensions.empty())
+    {
+        return;
+    }
+
+    if(!_perMessageDeflate || extensions.size() > 1 || extensions.front().front().first != _deflateExtension)
+    {
+        throw WebSocketException("unexpected value `" + value + "' for WebSocket extensions");
+    }
+
+    bool clientNoContextTakeover = _noContextTakeover;
+    const ExtensionParams& params = extensions.front();
+    for(ExtensionParams::const_iterator p = params.begin() + 1; p != params.end(); ++p)
+    {
+        int bits;
+        if(p->first == "client_no_context_takeover" && p->second.empty())
+        {
+            clientNoContextTakeover = true;
+        }
+        else if((p->first == "server_no_context_takeover" && p->second.empty()) ||
+                (p->first == "server_max_window_bits" && parseWindowBits(p->second, bits)))
+        {
+            //
+            // Only affects how the server compresses, we always inflate with
+            // the largest window.
+            //
+        }
+        else
+        {
+            throw WebSocketException("invalid parameter `" + p->first + "' for WebSocket extension " +
+                                     _deflateExtension);
+        }
+    }
+
+    initDeflate(15);
+    _deflateNoContextTakeover = clientNoContextTakeover;
+}
+
+void
+IceInternal::WSTransceiver::initDeflate(int windowBits)
+{
+#ifdef ICE_HAS_ZLIB
+    assert(!_deflateStream && !_inflateStream);
+
+    //
+    // Negative window bits select raw deflate streams, without the zlib
+    // header and checksum.
+    //
+    _deflateStream = new z_stream;
+    memset(_deflateStream, 0, sizeof(z_stream));
+    if(deflateInit2(_deflateStream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -windowBits, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+    {
+        delete _deflateStream;
+        _deflateStream = 0;
+        throw WebSocketException("unable to initialize the permessage-deflate compressor");
+    }
+
+    _inflateStream = new z_stream;
+    memset(_inflateStream, 0, sizeof(z_stream));
+    if(inflateInit2(_inflateStream, -15) != Z_OK)
+    {
+        delete _inflateStream;
+        _inflateStream = 0;
+        throw WebSocketException("unable to initialize the permessage-deflate decompressor");
+    }
+#else
+    throw WebSocketException("permessage-deflate is not supported");
+#endif
+}
+
+bool
+IceInternal::WSTransceiver::useDeflate(const Buffer& buf) const
+{
+    //
+    // Don't compress small messages, or messages that were already
+    // compressed by the Ice protocol (compression status 2).
+    //
+    return _deflateStream &&
+           _deflateThreshold >= 0 &&
+           buf.b.size() >= static_cast<size_t>(max(_deflateThreshold, headerSize)) &&
+           buf.b[9] != 2;
+}
+
+size_t
+IceInternal::WSTransceiver::deflateMessage(const Buffer& buf)
+{
+#ifdef ICE_HAS_ZLIB
+    z_stream* stream = _deflateStream;
+    stream->next_in = const_cast<Bytef*>(reinterpret_cast<const Bytef*>(&buf.b[0]));
+    stream->avail_in = static_cast<uInt>(buf.b.size());
+
+    //
+    // The bound doesn't account for the sync flush marker, so allow some
+    // room for it; the loop below grows the buffer if it's still too small.
+    //
+    size_t bound = deflateBound(stream, static_cast<uLong>(buf.b.size())) + 16;
+    if(_deflateBuffer.size() < bound)
+    {
+        _deflateBuffer.resize(bound);
+    }
+
+    size_t size = 0;
+    while(true)
+    {
+        stream->next_out = &_deflateBuffer[size];
+        stream->avail_out = static_cast<uInt>(_deflateBuffer.size() - size);
+        int rc = deflate(stream, Z_SYNC_FLUSH);
+        size = _deflateBuffer.size() - stream->avail_out;
+        if(rc != Z_OK && rc != Z_BUF_ERROR)
+        {
+            CompressionException ex(__FILE__, __LINE__);
+            ex.reason = "deflate failed";
+            throw ex;
+        }
+        if(stream->avail_out > 0)
+        {
+            break;
+        }
+        _deflateBuffer.resize(_deflateBuffer.size() * 2);
+    }
+
+    if(_deflateNoContextTakeover)
+    {
+        deflateReset(stream);
+    }
+
+    //
+    // Remove the empty block added by the sync flush, as required by
+    // RFC 7692.
+    //
+    assert(size >= sizeof(_deflateTrailer));
+    assert(memcmp(&_deflateBuffer[size - sizeof(_deflateTrailer)], _deflateTrailer, sizeof(_deflateTrailer)) == 0);
+    return size - sizeof(_deflateTrailer);
+#else
+    assert(false);
+    return 0;
+#endif
+}
+
+size_t
+IceInternal::WSTransceiver::inflatePayload(Buffer& buf, const Byte* data, size_t size)
+{
+#ifdef ICE_HAS_ZLIB
+    z_stream* stream = _inflateStream;
+    stream->next_in = const_cast<Bytef*>(reinterpret_cast<const Bytef*>(data));
+    stream->avail_in = static_cast<uInt>(size);
+    stream->next_out = reinterpret_cast<Bytef*>(buf.i);
+    stream->avail_out = static_cast<uInt>(buf.b.end() - buf.i);
+
+    int rc = inflate(stream, Z_SYNC_FLUSH);
+    buf.i = buf.b.end() - stream->avail_out;
+    if(rc == Z_STREAM_END)
+    {
+        //
+        // The sender ended the stream with a final block, the next message
+        // starts a new stream and the rest of the input is the trailer.
+        //
+        inflateReset(stream);
+        return size;
+    }
+    else if(rc != Z_OK && rc != Z_BUF_ERROR)
+    {
+        CompressionException ex(__FILE__, __LINE__);
+        ex.reason = "inflate failed";
+        throw ex;
+    }
+    return size - stream->avail_in;
+#else
+    assert(false);
+    return 0;
+#endif
+}
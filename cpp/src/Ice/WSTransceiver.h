@@ -18,6 +18,12 @@
 #include <Ice/Network.h>
 #include <Ice/Buffer.h>
 
+//
+// The permessage-deflate extension requires zlib, ICE_HAS_ZLIB is defined
+// by the build when zlib is enabled (USE_ZLIB or ZLIB_HOME).
+//
+struct z_stream_s;
+
 namespace IceInternal
 {
 
@@ -64,6 +70,8 @@ public:
     virtual void checkSendSize(const Buffer&);
     virtual void setBufferSize(int rcvSize, int sndSize);
 
+    void setHttpRequestHandler(const HttpRequestHandlerPtr&);
+
 private:
 
     WSTransceiver(const ProtocolInstancePtr&, const TransceiverPtr&, const std::string&, int, const std::string&);
@@ -71,6 +79,7 @@ private:
     virtual ~WSTransceiver();
 
     void handleRequest(Buffer&);
+    void handleHttpRequest(Buffer&);
     void handleResponse();
 
     bool preRead(Buffer&);
@@ -82,6 +91,14 @@ private:
     bool readBuffered(Buffer::Container::size_type);
     void prepareWriteHeader(Ice::Byte, Buffer::Container::size_type);
 
+    std::string getDeflateOffer() const;
+    std::string acceptDeflateOffer(const std::string&);
+    void checkDeflateResponse(const std::string&);
+    void initDeflate(int);
+    bool useDeflate(const Buffer&) const;
+    size_t deflateMessage(const Buffer&);
+    size_t inflatePayload(Buffer&, const Ice::Byte*, size_t);
+
     friend class WSConnector;
     friend class WSAcceptor;
 
@@ -111,6 +128,8 @@ private:
 
     HttpParserPtr _parser;
     std::string _key;
+    HttpRequestHandlerPtr _httpHandler;
+    bool _httpRequest;
 
     enum ReadState
     {
@@ -118,6 +137,7 @@ private:
         ReadStateHeader,
         ReadStateControlFrame,
         ReadStatePayload,
+        ReadStateCompressedPayload,
     };
 
     ReadState _readState;
@@ -138,6 +158,7 @@ private:
         WriteStateHeader,
         WriteStatePayload,
         WriteStateControlFrame,
+        WriteStateCompressedPayload,
     };
 
     WriteState _writeState;
@@ -153,6 +174,22 @@ private:
     int _closingReason;
 
     std::vector<Ice::Byte> _pingPayload;
+
+    //
+    // permessage-deflate (RFC 7692) settings and state. The streams are
+    // only allocated once the extension is negotiated.
+    //
+    const bool _perMessageDeflate;
+    const bool _noContextTakeover;
+    const int _deflateThreshold;
+    bool _deflateNoContextTakeover;
+    z_stream_s* _deflateStream;
+    z_stream_s* _inflateStream;
+    std::vector<Ice::Byte> _deflateBuffer;
+    bool _readCompressed;
+    size_t _readCompressedOffset;
+    size_t _readUnmasked;
+    size_t _readTrailerPos;
 };
 typedef IceUtil::Handle<WSTransceiver> WSTransceiverPtr;
 
@@ -42,6 +42,10 @@
 #   include <grp.h> // for initgroups
 #endif
 
+#if defined(__linux)
+#   include <sys/syscall.h>
+#endif
+
 using namespace std;
 using namespace Ice;
 using namespace IceInternal;
@@ -109,6 +113,76 @@ reportChildError(int err, int fd, const char* cannot, const char* name, const Tr
     _exit(EXIT_FAILURE);
 }
 
+#if defined(__linux)
+//
+// Linux getdents64 directory entry, not provided by the C library headers.
+//
+struct LinuxDirent64
+{
+    IceUtil::Int64 d_ino;
+    IceUtil::Int64 d_off;
+    unsigned short d_reclen;
+    unsigned char d_type;
+    char d_name[1];
+};
+
+//
+// Close the file descriptors of the child process listed in /proc/self/fd
+// instead of calling close() on each possible file descriptor up to the
+// maximum, which is slow when the file descriptor limit is high. Only async
+// signal safe system calls are used here (opendir/readdir aren't). Returns
+// false if /proc/self/fd can't be read.
+//
+bool
+closeProcFileDescriptors(int keepFd1, int keepFd2)
+{
+    int dirFd = open("/proc/self/fd", O_RDONLY | O_DIRECTORY);
+    if(dirFd == -1)
+    {
+        return false;
+    }
+
+    char buf[1024];
+    while(true)
+    {
+        long sz = syscall(SYS_getdents64, dirFd, buf, sizeof(buf));
+        if(sz < 0)
+        {
+            close(dirFd);
+            return false;
+        }
+        else if(sz == 0)
+        {
+            break;
+        }
+
+        for(long pos = 0; pos < sz;)
+        {
+            LinuxDirent64* entry = reinterpret_cast<LinuxDirent64*>(buf + pos);
+            pos += entry->d_reclen;
+
+            int fd = 0;
+            const char* p = entry->d_name;
+            if(*p < '0' || *p > '9')
+            {
+                continue; // "." or ".."
+            }
+            for(; *p >= '0' && *p <= '9'; ++p)
+            {
+                fd = fd * 10 + (*p - '0');
+            }
+
+            if(fd >= 3 && fd != dirFd && fd != keepFd1 && fd != keepFd2)
+            {
+                close(fd);
+            }
+        }
+    }
+    close(dirFd);
+    return true;
+}
+#endif
+
 #endif
 
 string
@@ -297,9 +371,11 @@ extern "C" void CALLBACK activatorWaitCallback(PVOID data, BOOLEAN)
 }
 #endif
 
-Activator::Activator(const TraceLevelsPtr& traceLevels) :
+Activator::Activator(const TraceLevelsPtr& traceLevels, int maxActivations) :
     _traceLevels(traceLevels),
-    _deactivating(false)
+    _deactivating(false),
+    _maxActivations(maxActivations),
+    _activations(0)
 {
 #ifdef _WIN32
     _hIntr = CreateEvent(
@@ -348,6 +424,33 @@ Activator::~Activator()
 #endif
 }
 
+//
+// Releases the activation slot acquired by activate() once the
+// activation completes or fails. It must be destroyed with the
+// activator unlocked.
+//
+class Activator::ActivationSlot
+{
+public:
+
+    ActivationSlot(Activator& activator) : _activator(activator)
+    {
+    }
+
+    ~ActivationSlot()
+    {
+        IceUtil::Monitor< IceUtil::Mutex>::Lock sync(_activator);
+        if(--_activator._activations < _activator._maxActivations)
+        {
+            _activator.notifyAll();
+        }
+    }
+
+private:
+
+    Activator& _activator;
+};
+
 int
 Activator::activate(const string& name,
                     const string& exePath,
@@ -360,12 +463,28 @@ Activator::activate(const string& name,
                     const Ice::StringSeq& envs,
                     const ServerIPtr& server)
 {
-    IceUtil::Monitor< IceUtil::Mutex>::Lock sync(*this);
-
-    if(_deactivating)
+    //
+    // The activator isn't locked while the process is created, this
+    // allows multiple servers to be activated concurrently (forking
+    // a large node process and waiting for the exec can take a while).
+    // The lock is only acquired to register the new process. The
+    // number of concurrent activations is limited by
+    // IceGrid.Node.MaxActivations, activations wait for a slot once
+    // the limit is reached.
+    //
     {
-        throw string("The node is being shutdown.");
+        IceUtil::Monitor< IceUtil::Mutex>::Lock sync(*this);
+        while(!_deactivating && _maxActivations > 0 && _activations >= _maxActivations)
+        {
+            wait();
+        }
+        if(_deactivating)
+        {
+            throw string("The node is being shutdown.");
+        }
+        ++_activations;
     }
+    ActivationSlot slot(*this);
 
     string path = exePath;
     if(path.empty())
@@ -574,6 +693,12 @@ Activator::activate(const string& name,
         env = envbuf.c_str();
     }
 
+    IceUtil::Monitor< IceUtil::Mutex>::Lock sync(*this);
+    if(_deactivating)
+    {
+        throw string("The node is being shutdown.");
+    }
+
     Process process;
 
     STARTUPINFOW si;
@@ -742,12 +867,17 @@ Activator::activate(const string& name,
         // standard output, standard error, and the write side
         // of the newly created pipe.
         //
-        int maxFd = static_cast<int>(sysconf(_SC_OPEN_MAX));
-        for(int fd = 3; fd < maxFd; ++fd)
+#if defined(__linux)
+        if(!closeProcFileDescriptors(fds[1], errorFds[1]))
+#endif
         {
-            if(fd != fds[1] && fd != errorFds[1])
+            int maxFd = static_cast<int>(sysconf(_SC_OPEN_MAX));
+            for(int fd = 3; fd < maxFd; ++fd)
             {
-                close(fd);
+                if(fd != fds[1] && fd != errorFds[1])
+                {
+                    close(fd);
+                }
             }
         }
 
@@ -831,6 +961,19 @@ Activator::activate(const string& name,
         //
         close(errorFds[0]);
 
+        IceUtil::Monitor< IceUtil::Mutex>::Lock sync(*this);
+        if(_deactivating)
+        {
+            //
+            // The node was shutdown while the process was created, the
+            // activator no longer accepts new processes.
+            //
+            ::kill(pid, SIGKILL);
+            close(fds[0]);
+            waitPid(pid);
+            throw string("The node is being shutdown.");
+        }
+
         Process process;
         process.pid = pid;
         process.pipeFd = fds[0];
@@ -47,7 +47,7 @@ public:
         ServerIPtr server;
     };
 
-    Activator(const TraceLevelsPtr&);
+    Activator(const TraceLevelsPtr&, int = 0);
     virtual ~Activator();
 
     virtual int activate(const std::string&, const std::string&, const std::string&,
@@ -77,6 +77,8 @@ public:
 
 private:
 
+    class ActivationSlot;
+
     void terminationListener();
     void clearInterrupt();
     void setInterrupt();
@@ -88,6 +90,8 @@ private:
     TraceLevelsPtr _traceLevels;
     std::map<std::string, Process> _processes;
     bool _deactivating;
+    const int _maxActivations;
+    int _activations;
 
 #ifdef _WIN32
     HANDLE _hIntr;
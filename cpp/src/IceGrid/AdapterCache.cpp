@@ -175,7 +175,9 @@ typedef IceUtil::Handle<ReplicaGroupSyncCallback> ReplicaGroupSyncCallbackPtr;
 
 }
 
-AdapterCache::AdapterCache(const Ice::CommunicatorPtr& communicator) : _communicator(communicator)
+AdapterCache::AdapterCache(const Ice::CommunicatorPtr& communicator) :
+    _communicator(communicator),
+    _adaptiveTwoChoices(communicator->getProperties()->getPropertyAsInt("IceGrid.Registry.AdaptiveTwoChoices") > 0)
 {
 }
 
@@ -613,6 +615,7 @@ ReplicaGroupEntry::getLocatorAdapterInfo(LocatorAdapterInfoSeq& adapters, int& n
 {
     vector<ServerAdapterEntryPtr> replicas;
     bool adaptive = false;
+    bool twoChoices = false;
     LoadSample loadSample = LoadSample1;
     {
         Lock sync(*this);
@@ -649,6 +652,7 @@ ReplicaGroupEntry::getLocatorAdapterInfo(LocatorAdapterInfoSeq& adapters, int& n
             random_shuffle(replicas.begin(), replicas.end(), rng);
             loadSample = _loadSample;
             adaptive = true;
+            twoChoices = _cache.adaptiveTwoChoices() && nReplicas == 1;
         }
         else if(OrderedLoadBalancingPolicyPtr::dynamicCast(_loadBalancing))
         {
@@ -678,7 +682,27 @@ ReplicaGroupEntry::getLocatorAdapterInfo(LocatorAdapterInfoSeq& adapters, int& n
             //
             vector<pair<float, ServerAdapterEntryPtr> > rl;
             transform(replicas.begin(), replicas.end(), back_inserter(rl), TransformToReplicaLoad(loadSample));
-            sort(rl.begin(), rl.end(), ReplicaLoadComp());
+            if(twoChoices && rl.size() > 2)
+            {
+                //
+                // With IceGrid.Registry.AdaptiveTwoChoices, the replica
+                // returned is the least loaded of two randomly chosen
+                // replicas (the replicas are already shuffled) rather
+                // than the least loaded replica. This prevents all the
+                // clients from picking the same replica until the next
+                // node load update. The other replicas are sorted by load
+                // and are only used if the chosen replica is unreachable.
+                //
+                if(rl[1].first < rl[0].first)
+                {
+                    swap(rl[0], rl[1]);
+                }
+                sort(rl.begin() + 1, rl.end(), ReplicaLoadComp());
+            }
+            else
+            {
+                sort(rl.begin(), rl.end(), ReplicaLoadComp());
+            }
             replicas.clear();
             transform(rl.begin(), rl.end(), back_inserter(replicas), TransformToReplica());
         }
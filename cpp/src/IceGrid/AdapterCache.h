@@ -149,6 +149,8 @@ public:
     void removeServerAdapter(const std::string&);
     void removeReplicaGroup(const std::string&);
 
+    bool adaptiveTwoChoices() const { return _adaptiveTwoChoices; }
+
 protected:
     
     virtual AdapterEntryPtr addImpl(const std::string&, const AdapterEntryPtr&);
@@ -157,6 +159,7 @@ protected:
 private:
 
     const Ice::CommunicatorPtr _communicator;
+    const bool _adaptiveTwoChoices;
 };
 
 };
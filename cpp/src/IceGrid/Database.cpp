@@ -179,6 +179,36 @@ updateSerial(const Freeze::ConnectionPtr& connection, const string& dbName, Ice:
     }
 }
 
+bool
+isSynchronized(const Freeze::ConnectionPtr& connection, const string& dbName, Ice::Long serial)
+{
+    //
+    // A replica database doesn't need to be synchronized if it's already
+    // at the serial of the master database. Serial 1 is ignored since
+    // it's also the serial of a newly created database.
+    //
+    if(serial <= 1)
+    {
+        return false;
+    }
+
+    SerialsDict dict(connection, serialsDbName);
+    SerialsDict::const_iterator p = dict.find(dbName);
+    return p != dict.end() && p->second == serial;
+}
+
+//
+// Returns the number of records received from the master and the time
+// taken to synchronize the database, for tracing.
+//
+string
+syncStats(size_t count, const IceUtil::Time& start)
+{
+    ostringstream os;
+    os << count << " records, " << (IceUtil::Time::now(IceUtil::Time::Monotonic) - start).toDuration();
+    return os.str();
+}
+
 vector<AdapterInfo>
 findByReplicaGroupId(const StringAdapterInfoDict& dict, const string& name)
 {
@@ -235,7 +265,13 @@ Database::Database(const Ice::ObjectAdapterPtr& registryAdapter,
 {
     ServerEntrySeq entries;
 
-    for(StringApplicationInfoDict::iterator p = _applications.begin(); p != _applications.end(); ++p)
+    //
+    // Read the applications from the database only once, the same
+    // snapshot is used to load the caches and to initialize the
+    // application observer topic.
+    //
+    map<string, ApplicationInfo> applications = toMap(_applications);
+    for(map<string, ApplicationInfo>::const_iterator p = applications.begin(); p != applications.end(); ++p)
     {
         try
         {
@@ -257,7 +293,7 @@ Database::Database(const Ice::ObjectAdapterPtr& registryAdapter,
 
     _nodeObserverTopic = new NodeObserverTopic(_topicManager, _internalAdapter);
     _registryObserverTopic = new RegistryObserverTopic(_topicManager);
-    _applicationObserverTopic = new ApplicationObserverTopic(_topicManager, toMap(_applications), getSerial(_connection, applicationsDbName));
+    _applicationObserverTopic = new ApplicationObserverTopic(_topicManager, applications, getSerial(_connection, applicationsDbName));
     _adapterObserverTopic = new AdapterObserverTopic(_topicManager, toMap(_adapters), getSerial(_connection, adaptersDbName));
     _objectObserverTopic = new ObjectObserverTopic(_topicManager, toMap(_objects), getSerial(_connection, objectsDbName));
 
@@ -352,73 +388,87 @@ Database::syncApplications(const ApplicationInfoSeq& newApplications, Ice::Long
     {
         Lock sync(*this);
 
-        map<string, ApplicationInfo> oldApplications;
-        for(;;)
+        IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        if(isSynchronized(_connection, applicationsDbName, dbSerial))
         {
-            try
-            {
-                TransactionHolder txHolder(_connection);
-                oldApplications = toMap(_applications);
-                _applications.clear();
-                for(ApplicationInfoSeq::const_iterator p = newApplications.begin(); p != newApplications.end(); ++p)
-                {
-                    _applications.put(StringApplicationInfoDict::value_type(p->descriptor.name, *p));
-                }
-                dbSerial = updateSerial(_connection, applicationsDbName, dbSerial);
-                txHolder.commit();
-                break;
-            }
-            catch(const DeadlockException&)
-            {
-                continue;
-            }
-            catch(const DatabaseException& ex)
+            if(_traceLevels->application > 0)
             {
-                halt(_communicator, ex);
+                Ice::Trace out(_traceLevels->logger, _traceLevels->applicationCat);
+                out << "applications already synchronized (serial = `" << dbSerial << "', ";
+                out << syncStats(newApplications.size(), start) << ")";
             }
         }
-
-        ServerEntrySeq entries;
-        set<string> names;
-
-        for(ApplicationInfoSeq::const_iterator p = newApplications.begin(); p != newApplications.end(); ++p)
+        else
         {
-            try
+            map<string, ApplicationInfo> oldApplications;
+            for(;;)
             {
-                map<string, ApplicationInfo>::const_iterator q = oldApplications.find(p->descriptor.name);
-                if(q != oldApplications.end())
+                try
+                {
+                    TransactionHolder txHolder(_connection);
+                    oldApplications = toMap(_applications);
+                    _applications.clear();
+                    for(ApplicationInfoSeq::const_iterator p = newApplications.begin(); p != newApplications.end(); ++p)
+                    {
+                        _applications.put(StringApplicationInfoDict::value_type(p->descriptor.name, *p));
+                    }
+                    dbSerial = updateSerial(_connection, applicationsDbName, dbSerial);
+                    txHolder.commit();
+                    break;
+                }
+                catch(const DeadlockException&)
                 {
-                    ApplicationHelper previous(_communicator, q->second.descriptor);
-                    ApplicationHelper helper(_communicator, p->descriptor);
-                    reload(previous, helper, entries, p->uuid, p->revision, false);
+                    continue;
                 }
-                else
+                catch(const DatabaseException& ex)
                 {
-                    load(ApplicationHelper(_communicator, p->descriptor), entries, p->uuid, p->revision);
+                    halt(_communicator, ex);
                 }
             }
-            catch(const DeploymentException& ex)
+
+            ServerEntrySeq entries;
+            set<string> names;
+
+            for(ApplicationInfoSeq::const_iterator p = newApplications.begin(); p != newApplications.end(); ++p)
             {
-                Ice::Warning warn(_traceLevels->logger);
-                warn << "invalid application `" << p->descriptor.name << "':\n" << ex.reason;
+                try
+                {
+                    map<string, ApplicationInfo>::const_iterator q = oldApplications.find(p->descriptor.name);
+                    if(q != oldApplications.end())
+                    {
+                        ApplicationHelper previous(_communicator, q->second.descriptor);
+                        ApplicationHelper helper(_communicator, p->descriptor);
+                        reload(previous, helper, entries, p->uuid, p->revision, false);
+                    }
+                    else
+                    {
+                        load(ApplicationHelper(_communicator, p->descriptor), entries, p->uuid, p->revision);
+                    }
+                }
+                catch(const DeploymentException& ex)
+                {
+                    Ice::Warning warn(_traceLevels->logger);
+                    warn << "invalid application `" << p->descriptor.name << "':\n" << ex.reason;
+                }
+                names.insert(p->descriptor.name);
             }
-            names.insert(p->descriptor.name);
-        }
 
-        for(map<string, ApplicationInfo>::iterator s = oldApplications.begin(); s != oldApplications.end(); ++s)
-        {
-            if(names.find(s->first) == names.end())
+            for(map<string, ApplicationInfo>::iterator s = oldApplications.begin(); s != oldApplications.end(); ++s)
             {
-                unload(ApplicationHelper(_communicator, s->second.descriptor), entries);
+                if(names.find(s->first) == names.end())
+                {
+                    unload(ApplicationHelper(_communicator, s->second.descriptor), entries);
+                }
             }
-        }
 
-        for_each(entries.begin(), entries.end(), IceUtil::voidMemFun(&ServerEntry::sync));
+            for_each(entries.begin(), entries.end(), IceUtil::voidMemFun(&ServerEntry::sync));
 
-        if(_traceLevels->application > 0)
-        {
-            Ice::Trace out(_traceLevels->logger, _traceLevels->applicationCat);
-            out << "synchronized applications (serial = `" << dbSerial << "')";
+            if(_traceLevels->application > 0)
+            {
+                Ice::Trace out(_traceLevels->logger, _traceLevels->applicationCat);
+                out << "synchronized applications (serial = `" << dbSerial << "', ";
+                out << syncStats(newApplications.size(), start) << ")";
+            }
         }
 
         serial = _applicationObserverTopic->applicationInit(dbSerial, newApplications);
@@ -433,36 +483,50 @@ Database::syncAdapters(const AdapterInfoSeq& adapters, Ice::Long dbSerial)
     int serial = 0;
     {
         Lock sync(*this);
-        for(;;)
+        IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        if(isSynchronized(_connection, adaptersDbName, dbSerial))
         {
-            try
+            if(_traceLevels->adapter > 0)
             {
-                TransactionHolder txHolder(_connection);
-                _adapters.clear();
-                for(AdapterInfoSeq::const_iterator r = adapters.begin(); r != adapters.end(); ++r)
-                {
-                    _adapters.put(StringAdapterInfoDict::value_type(r->id, *r));
-                }
-                dbSerial = updateSerial(_connection, adaptersDbName, dbSerial);
-                txHolder.commit();
-                break;
+                Ice::Trace out(_traceLevels->logger, _traceLevels->adapterCat);
+                out << "adapters already synchronized (serial = `" << dbSerial << "', ";
+                out << syncStats(adapters.size(), start) << ")";
             }
-            catch(const DeadlockException&)
+        }
+        else
+        {
+            for(;;)
             {
-                continue;
+                try
+                {
+                    TransactionHolder txHolder(_connection);
+                    _adapters.clear();
+                    for(AdapterInfoSeq::const_iterator r = adapters.begin(); r != adapters.end(); ++r)
+                    {
+                        _adapters.put(StringAdapterInfoDict::value_type(r->id, *r));
+                    }
+                    dbSerial = updateSerial(_connection, adaptersDbName, dbSerial);
+                    txHolder.commit();
+                    break;
+                }
+                catch(const DeadlockException&)
+                {
+                    continue;
+                }
+                catch(const DatabaseException& ex)
+                {
+                    halt(_communicator, ex);
+                }
             }
-            catch(const DatabaseException& ex)
+
+            if(_traceLevels->adapter > 0)
             {
-                halt(_communicator, ex);
+                Ice::Trace out(_traceLevels->logger, _traceLevels->adapterCat);
+                out << "synchronized adapters (serial = `" << dbSerial << "', ";
+                out << syncStats(adapters.size(), start) << ")";
             }
         }
 
-        if(_traceLevels->adapter > 0)
-        {
-            Ice::Trace out(_traceLevels->logger, _traceLevels->adapterCat);
-            out << "synchronized adapters (serial = `" << dbSerial << "')";
-        }
-
         serial = _adapterObserverTopic->adapterInit(dbSerial, adapters);
     }
     _adapterObserverTopic->waitForSyncedSubscribers(serial);
@@ -475,36 +539,50 @@ Database::syncObjects(const ObjectInfoSeq& objects, Ice::Long dbSerial)
     int serial = 0;
     {
         Lock sync(*this);
-        for(;;)
+        IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        if(isSynchronized(_connection, objectsDbName, dbSerial))
         {
-            try
+            if(_traceLevels->object > 0)
             {
-                TransactionHolder txHolder(_connection);
-                _objects.clear();
-                for(ObjectInfoSeq::const_iterator q = objects.begin(); q != objects.end(); ++q)
-                {
-                    _objects.put(IdentityObjectInfoDict::value_type(q->proxy->ice_getIdentity(), *q));
-                }
-                dbSerial = updateSerial(_connection, objectsDbName, dbSerial);
-                txHolder.commit();
-                break;
+                Ice::Trace out(_traceLevels->logger, _traceLevels->objectCat);
+                out << "objects already synchronized (serial = `" << dbSerial << "', ";
+                out << syncStats(objects.size(), start) << ")";
             }
-            catch(const DeadlockException&)
+        }
+        else
+        {
+            for(;;)
             {
-                continue;
+                try
+                {
+                    TransactionHolder txHolder(_connection);
+                    _objects.clear();
+                    for(ObjectInfoSeq::const_iterator q = objects.begin(); q != objects.end(); ++q)
+                    {
+                        _objects.put(IdentityObjectInfoDict::value_type(q->proxy->ice_getIdentity(), *q));
+                    }
+                    dbSerial = updateSerial(_connection, objectsDbName, dbSerial);
+                    txHolder.commit();
+                    break;
+                }
+                catch(const DeadlockException&)
+                {
+                    continue;
+                }
+                catch(const DatabaseException& ex)
+                {
+                    halt(_communicator, ex);
+                }
             }
-            catch(const DatabaseException& ex)
+
+            if(_traceLevels->object > 0)
             {
-                halt(_communicator, ex);
+                Ice::Trace out(_traceLevels->logger, _traceLevels->objectCat);
+                out << "synchronized objects (serial = `" << dbSerial << "', ";
+                out << syncStats(objects.size(), start) << ")";
             }
         }
 
-        if(_traceLevels->object > 0)
-        {
-            Ice::Trace out(_traceLevels->logger, _traceLevels->objectCat);
-            out << "synchronized objects (serial = `" << dbSerial << "')";
-        }
-
         serial = _objectObserverTopic->objectInit(dbSerial, objects);
     }
     _objectObserverTopic->waitForSyncedSubscribers(serial);
@@ -300,7 +300,7 @@ NodeService::startImpl(int argc, char* argv[], int& status)
     // Create the activator.
     //
     TraceLevelsPtr traceLevels = new TraceLevels(communicator(), "IceGrid.Node");
-    _activator = new Activator(traceLevels);
+    _activator = new Activator(traceLevels, properties->getPropertyAsIntWithDefault("IceGrid.Node.MaxActivations", 4));
 
     //
     // Collocate the IceGrid registry if we need to.
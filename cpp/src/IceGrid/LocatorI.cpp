@@ -151,6 +151,117 @@ private:
     const Ice::ObjectPrx _obj;
 };
 
+//
+// Collects the responses of the LocatorI::findAdapterById_async()
+// calls made by LocatorI::findAdaptersById_async().
+//
+class FindAdaptersByIdResponse : public IceUtil::Shared, public IceUtil::Mutex
+{
+public:
+
+    FindAdaptersByIdResponse(const AMD_Locator_findAdaptersByIdPtr& cb, size_t count) :
+        _cb(cb),
+        _proxies(count),
+        _count(count),
+        _sent(false)
+    {
+    }
+
+    void response(size_t index, const Ice::ObjectPrx& proxy)
+    {
+        {
+            Lock sync(*this);
+            assert(index < _proxies.size());
+            _proxies[index] = proxy;
+            if(--_count > 0 || _sent)
+            {
+                return;
+            }
+            _sent = true;
+        }
+        _cb->ice_response(_proxies);
+    }
+
+    void exception(const std::exception& ex)
+    {
+        {
+            Lock sync(*this);
+            if(_sent)
+            {
+                return;
+            }
+            _sent = true;
+        }
+        _cb->ice_exception(ex);
+    }
+
+    void exception()
+    {
+        {
+            Lock sync(*this);
+            if(_sent)
+            {
+                return;
+            }
+            _sent = true;
+        }
+        _cb->ice_exception();
+    }
+
+private:
+
+    const AMD_Locator_findAdaptersByIdPtr _cb;
+    Ice::ObjectProxySeq _proxies;
+    size_t _count;
+    bool _sent;
+};
+typedef IceUtil::Handle<FindAdaptersByIdResponse> FindAdaptersByIdResponsePtr;
+
+//
+// Callback from asynchronous call to LocatorI::findAdapterById_async()
+// invoked in LocatorI::findAdaptersById_async().
+//
+class AMD_Locator_findAdapterByIdBatchI : public Ice::AMD_Locator_findAdapterById
+{
+public:
+
+    AMD_Locator_findAdapterByIdBatchI(const FindAdaptersByIdResponsePtr& response, size_t index) :
+        _response(response),
+        _index(index)
+    {
+    }
+
+    virtual void ice_response(const ::Ice::ObjectPrx& obj)
+    {
+        _response->response(_index, obj);
+    }
+
+    virtual void ice_exception(const std::exception& ex)
+    {
+        if(dynamic_cast<const Ice::AdapterNotFoundException*>(&ex))
+        {
+            //
+            // A null proxy is returned for adapters which can't be found.
+            //
+            _response->response(_index, 0);
+        }
+        else
+        {
+            _response->exception(ex);
+        }
+    }
+
+    virtual void ice_exception()
+    {
+        _response->exception();
+    }
+
+private:
+
+    const FindAdaptersByIdResponsePtr _response;
+    const size_t _index;
+};
+
 class AdapterRequest : public LocatorI::Request
 {
 public:
@@ -931,6 +1042,37 @@ LocatorI::findAdapterById_async(const Ice::AMD_Locator_findAdapterByIdPtr& cb,
     }
 }
 
+//
+// Find multiple adapters by identity. Each adapter is resolved
+// concurrently with findAdapterById_async() and the response is sent
+// once all the adapters are resolved.
+//
+void
+LocatorI::findAdaptersById_async(const AMD_Locator_findAdaptersByIdPtr& cb,
+                                 const Ice::StringSeq& ids,
+                                 const Ice::Current& current) const
+{
+    if(ids.empty())
+    {
+        cb->ice_response(Ice::ObjectProxySeq());
+        return;
+    }
+
+    FindAdaptersByIdResponsePtr response = new FindAdaptersByIdResponse(cb, ids.size());
+    for(Ice::StringSeq::size_type i = 0; i < ids.size(); ++i)
+    {
+        Ice::AMD_Locator_findAdapterByIdPtr amdCB = new AMD_Locator_findAdapterByIdBatchI(response, i);
+        try
+        {
+            findAdapterById_async(amdCB, ids[i], current);
+        }
+        catch(const Ice::Exception& ex)
+        {
+            amdCB->ice_exception(ex);
+        }
+    }
+}
+
 Ice::LocatorRegistryPrx
 LocatorI::getRegistry(const Ice::Current&) const
 {
@@ -57,6 +57,9 @@ public:
     virtual void findAdapterById_async(const Ice::AMD_Locator_findAdapterByIdPtr&, const ::std::string&, 
                                        const Ice::Current& = Ice::Current()) const;
 
+    virtual void findAdaptersById_async(const AMD_Locator_findAdaptersByIdPtr&, const Ice::StringSeq&,
+                                        const Ice::Current&) const;
+
     virtual Ice::LocatorRegistryPrx getRegistry(const Ice::Current&) const;
     virtual RegistryPrx getLocalRegistry(const Ice::Current&) const;
     virtual QueryPrx getLocalQuery(const Ice::Current&) const;
@@ -38,7 +38,8 @@
     "$(slicedir)\IceGrid\Locator.ice" \
     "$(slicedir)/Ice/Locator.ice" \
     "$(slicedir)/Ice/Identity.ice" \
-    "$(slicedir)/Ice/ProcessF.ice"
+    "$(slicedir)/Ice/ProcessF.ice" \
+    "$(slicedir)/Ice/BuiltinSequences.ice"
 
 ..\Observer.h: \
     "$(slicedir)\IceGrid\Observer.ice" \
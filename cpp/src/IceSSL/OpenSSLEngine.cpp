@@ -72,6 +72,11 @@ Init init;
 extern "C"
 {
 
+//
+// OpenSSL new session callback, defined in OpenSSLTransceiverI.cpp.
+//
+int IceSSL_opensslNewSessionCallback(SSL*, SSL_SESSION*);
+
 //
 // OpenSSL mutex callback.
 //
@@ -168,7 +173,8 @@ IceUtil::Shared* IceSSL::upCast(IceSSL::OpenSSLEngine* p) { return p; }
 OpenSSLEngine::OpenSSLEngine(const CommunicatorPtr& communicator) :
     SSLEngine(communicator),
     _initialized(false),
-    _ctx(0)
+    _ctx(0),
+    _sessionCacheSize(0)
 {
     __setNoDelete(true);
 
@@ -797,15 +803,56 @@ OpenSSLEngine::initialize()
         SSL_CTX_set_ex_data(_ctx, 0, this);
 
         //
-        // This is necessary for successful interop with Java. Without it, a Java
-        // client would fail to reestablish a connection: the server gets the
-        // error "session id context uninitialized" and the client receives
-        // "SSLHandshakeException: Remote host closed connection during handshake".
+        // Session caching is disabled by default. This is necessary for successful
+        // interop with Java. Without it, a Java client would fail to reestablish a
+        // connection: the server gets the error "session id context uninitialized"
+        // and the client receives "SSLHandshakeException: Remote host closed
+        // connection during handshake".
         //
-        SSL_CTX_set_session_cache_mode(_ctx, SSL_SESS_CACHE_OFF);
+        // If IceSSL.SessionCacheSize is set, the server caches up to this number
+        // of sessions and the client caches the last session established with
+        // each peer to resume it when reconnecting, this saves the cost of a full
+        // handshake. Resumption with session tickets is handled by OpenSSL, the
+        // client cache also stores the tickets received from the server.
+        //
+        int sessionCacheSize = properties->getPropertyAsInt(propPrefix + "SessionCacheSize");
+        if(sessionCacheSize > 0)
+        {
+            _sessionCacheSize = static_cast<size_t>(sessionCacheSize);
+            SSL_CTX_set_session_cache_mode(_ctx, SSL_SESS_CACHE_SERVER | SSL_SESS_CACHE_CLIENT);
+            SSL_CTX_sess_set_cache_size(_ctx, sessionCacheSize);
+            SSL_CTX_sess_set_new_cb(_ctx, IceSSL_opensslNewSessionCallback);
+
+            int sessionCacheTimeout = properties->getPropertyAsIntWithDefault(propPrefix + "SessionCacheTimeout", 300);
+            if(sessionCacheTimeout > 0)
+            {
+                SSL_CTX_set_timeout(_ctx, sessionCacheTimeout);
+            }
+        }
+        else
+        {
+            SSL_CTX_set_session_cache_mode(_ctx, SSL_SESS_CACHE_OFF);
+        }
+
+        //
+        // With IceSSL.KernelTLS, OpenSSL hands the negotiated keys over to the
+        // kernel after the handshake if the kernel and OpenSSL support it, the
+        // record encryption is then done by the kernel.
+        //
+        if(properties->getPropertyAsInt(propPrefix + "KernelTLS") > 0)
+        {
+#  ifdef SSL_OP_ENABLE_KTLS
+            SSL_CTX_set_options(_ctx, SSL_OP_ENABLE_KTLS);
+#  else
+            if(securityTraceLevel() >= 1)
+            {
+                getLogger()->trace(securityTraceCategory(), "kernel TLS is not supported by this OpenSSL version");
+            }
+#  endif
+        }
 
         //
-        // Although we disable session caching, we still need to set a session ID
+        // Even if we disable session caching, we still need to set a session ID
         // context (ICE-5103). The value can be anything; here we just use the
         // pointer to this SharedInstance object.
         //
@@ -896,6 +943,55 @@ OpenSSLEngine::destroy()
     {
         SSL_CTX_free(_ctx);
     }
+
+    IceUtil::Mutex::Lock sync(_mutex);
+    for(map<string, SSL_SESSION*>::const_iterator p = _sessions.begin(); p != _sessions.end(); ++p)
+    {
+        SSL_SESSION_free(p->second);
+    }
+    _sessions.clear();
+    _sessionKeys.clear();
+}
+
+void
+OpenSSLEngine::resumeSession(SSL* ssl, const string& key)
+{
+    IceUtil::Mutex::Lock sync(_mutex);
+    map<string, SSL_SESSION*>::const_iterator p = _sessions.find(key);
+    if(p != _sessions.end())
+    {
+        SSL_set_session(ssl, p->second); // Takes its own reference on the session.
+    }
+}
+
+bool
+OpenSSLEngine::cacheSession(const string& key, SSL_SESSION* session)
+{
+    IceUtil::Mutex::Lock sync(_mutex);
+    if(_sessionCacheSize == 0)
+    {
+        return false;
+    }
+
+    map<string, SSL_SESSION*>::iterator p = _sessions.find(key);
+    if(p != _sessions.end())
+    {
+        SSL_SESSION_free(p->second);
+        p->second = session;
+        return true;
+    }
+
+    if(_sessions.size() >= _sessionCacheSize)
+    {
+        p = _sessions.find(_sessionKeys.front());
+        assert(p != _sessions.end());
+        SSL_SESSION_free(p->second);
+        _sessions.erase(p);
+        _sessionKeys.pop_front();
+    }
+    _sessions.insert(make_pair(key, session));
+    _sessionKeys.push_back(key);
+    return true; // The cache keeps the reference on the session.
 }
 
 #  ifndef OPENSSL_NO_DH
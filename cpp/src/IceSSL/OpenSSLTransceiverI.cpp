@@ -76,6 +76,13 @@ IceSSL_opensslVerifyCallback(int ok, X509_STORE_CTX* ctx)
     return p->verifyCallback(ok, ctx);
 }
 
+int
+IceSSL_opensslNewSessionCallback(SSL* ssl, SSL_SESSION* session)
+{
+    TransceiverI* p = reinterpret_cast<TransceiverI*>(SSL_get_ex_data(ssl, 0));
+    return p->newSessionCallback(session);
+}
+
 }
 
 IceInternal::NativeInfoPtr
@@ -144,6 +151,20 @@ IceSSL::TransceiverI::initialize(IceInternal::Buffer& readBuffer, IceInternal::B
             }
             SSL_set_verify(_ssl, sslVerifyMode, IceSSL_opensslVerifyCallback);
         }
+
+        //
+        // Offer the session previously established with this peer, if any. The
+        // sessions are cached per host and remote address.
+        //
+        if(!_incoming)
+        {
+            IceInternal::Address remoteAddr;
+            if(IceInternal::fdToRemoteAddress(_stream->fd(), remoteAddr))
+            {
+                _sessionKey = _host + "/" + IceInternal::addrToString(remoteAddr);
+                _engine->resumeSession(_ssl, _sessionKey);
+            }
+        }
     }
 
     while(!SSL_is_init_finished(_ssl))
@@ -250,6 +271,38 @@ IceSSL::TransceiverI::initialize(IceInternal::Buffer& readBuffer, IceInternal::B
         }
     }
 
+    _resumed = SSL_session_reused(_ssl) != 0;
+    if(_resumed && _nativeCerts.empty())
+    {
+        //
+        // The verify callback isn't called for resumed sessions, initialize
+        // the native certs with the peer certificates kept by the session.
+        // The chain returned by SSL_get_peer_cert_chain includes the peer
+        // certificate on the client side but not on the server side.
+        //
+        X509* cert = SSL_get_peer_certificate(_ssl);
+        if(cert != 0)
+        {
+            _nativeCerts.push_back(new Certificate(cert));
+            STACK_OF(X509)* chain = SSL_get_peer_cert_chain(_ssl); // Nothing needs to be free'd.
+            if(chain != 0)
+            {
+                for(int i = 0; i < sk_X509_num(chain); ++i)
+                {
+                    X509* c = sk_X509_value(chain, i);
+                    if(X509_cmp(c, cert) != 0)
+                    {
+                        _nativeCerts.push_back(new Certificate(X509_dup(c)));
+                    }
+                }
+            }
+        }
+    }
+#if defined(SSL_OP_ENABLE_KTLS) && !defined(OPENSSL_NO_KTLS)
+    _kernelTLSSend = BIO_get_ktls_send(SSL_get_wbio(_ssl)) > 0;
+    _kernelTLSRecv = BIO_get_ktls_recv(SSL_get_rbio(_ssl)) > 0;
+#endif
+
     long result = SSL_get_verify_result(_ssl);
     if(result != X509_V_OK)
     {
@@ -303,6 +356,17 @@ IceSSL::TransceiverI::initialize(IceInternal::Buffer& readBuffer, IceInternal::B
             out << "bits = " << SSL_CIPHER_get_bits(cipher, 0) << "\n";
             out << "protocol = " << SSL_get_version(_ssl) << "\n";
         }
+        out << "session = " << (_resumed ? "resumed" : "new") << "\n";
+        out << "kernel TLS = ";
+        if(_kernelTLSSend || _kernelTLSRecv)
+        {
+            out << (_kernelTLSSend ? "send" : "") << (_kernelTLSSend && _kernelTLSRecv ? ", " : "")
+                << (_kernelTLSRecv ? "receive" : "") << "\n";
+        }
+        else
+        {
+            out << "none\n";
+        }
         out << IceInternal::fdToString(SSL_get_fd(_ssl));
     }
 
@@ -352,6 +416,15 @@ IceSSL::TransceiverI::write(IceInternal::Buffer& buf)
         return IceInternal::SocketOperationNone;
     }
 
+    if(_kernelTLSSend)
+    {
+        //
+        // The kernel encrypts the data written to the socket, there's no
+        // need to go through OpenSSL.
+        //
+        return _stream->write(buf);
+    }
+
     //
     // It's impossible for packetSize to be more than an Int.
     //
@@ -461,6 +534,12 @@ IceSSL::TransceiverI::read(IceInternal::Buffer& buf, bool&)
         return IceInternal::SocketOperationNone;
     }
 
+    //
+    // Reads always go through SSL_read, even if the kernel decrypts the
+    // received records. Alerts and post-handshake messages such as
+    // close_notify, NewSessionTicket or KeyUpdate are passed up as
+    // control messages that only OpenSSL handles, reading the socket
+    // directly would fail with EIO when such a record is received.
     //
     // It's impossible for packetSize to be more than an Int.
     //
@@ -599,6 +678,20 @@ IceSSL::TransceiverI::setBufferSize(int rcvSize, int sndSize)
     _stream->setBufferSize(rcvSize, sndSize);
 }
 
+int
+IceSSL::TransceiverI::newSessionCallback(SSL_SESSION* session)
+{
+    //
+    // Server sessions are kept in the OpenSSL session cache. Returning 1
+    // tells OpenSSL that the client cache keeps the session reference.
+    //
+    if(_incoming || _sessionKey.empty())
+    {
+        return 0;
+    }
+    return _engine->cacheSession(_sessionKey, session) ? 1 : 0;
+}
+
 int
 IceSSL::TransceiverI::verifyCallback(int ok, X509_STORE_CTX* c)
 {
@@ -653,6 +746,9 @@ IceSSL::TransceiverI::TransceiverI(const InstancePtr& instance, const IceInterna
     _incoming(incoming),
     _stream(stream),
     _verified(false),
+    _resumed(false),
+    _kernelTLSSend(false),
+    _kernelTLSRecv(false),
     _ssl(0)
 {
 }
@@ -674,6 +770,7 @@ IceSSL::TransceiverI::fillConnectionInfo(const ConnectionInfoPtr& info, std::vec
     info->adapterName = _adapterName;
     info->incoming = _incoming;
     info->verified = _verified;
+    info->resumed = _resumed;
     nativeCerts = _nativeCerts;
     for(vector<CertificatePtr>::const_iterator p = _nativeCerts.begin(); p != _nativeCerts.end(); ++p)
     {
@@ -24,6 +24,7 @@
 #ifdef ICE_USE_OPENSSL
 
 typedef struct ssl_st SSL;
+typedef struct ssl_session_st SSL_SESSION;
 typedef struct bio_st BIO;
 
 namespace IceSSL
@@ -52,6 +53,7 @@ public:
     virtual void setBufferSize(int rcvSize, int sndSize);
 
     int verifyCallback(int , X509_STORE_CTX*);
+    int newSessionCallback(SSL_SESSION*);
 
 private:
 
@@ -70,6 +72,10 @@ private:
     const bool _incoming;
     const IceInternal::StreamSocketPtr _stream;
     bool _verified;
+    bool _resumed;
+    bool _kernelTLSSend;
+    bool _kernelTLSRecv;
+    std::string _sessionKey;
     std::vector<CertificatePtr> _nativeCerts;
 
     SSL* _ssl;
@@ -20,6 +20,9 @@
 #include <Ice/CommunicatorF.h>
 #include <Ice/Network.h>
 
+#include <map>
+#include <deque>
+
 #if defined(ICE_USE_SECURE_TRANSPORT)
 #   include <Security/Security.h>
 #elif defined(ICE_USE_SCHANNEL)
@@ -237,6 +240,12 @@ public:
     void context(SSL_CTX*);
     std::string sslErrors() const;
 
+    //
+    // Client session cache, see IceSSL.SessionCacheSize.
+    //
+    void resumeSession(SSL*, const std::string&);
+    bool cacheSession(const std::string&, SSL_SESSION*);
+
 private:
 
     SSL_METHOD* getMethod(int);
@@ -253,6 +262,10 @@ private:
     DHParamsPtr _dhParams;
 #   endif
     IceUtil::Mutex _mutex;
+
+    size_t _sessionCacheSize;
+    std::map<std::string, SSL_SESSION*> _sessions;
+    std::deque<std::string> _sessionKeys; // The cached sessions, oldest first.
 };
 #endif
 
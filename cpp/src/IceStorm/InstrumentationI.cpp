@@ -224,6 +224,42 @@ SubscriberHelper::Attributes SubscriberHelper::attributes;
 
 }
 
+TopicMetrics&
+IceMX::mergeMetrics(TopicMetrics& m, const TopicMetrics& other)
+{
+    mergeMetrics(static_cast<Metrics&>(m), other);
+    m.published += other.published;
+    m.forwarded += other.forwarded;
+    return m;
+}
+
+SubscriberMetrics&
+IceMX::mergeMetrics(SubscriberMetrics& m, const SubscriberMetrics& other)
+{
+    mergeMetrics(static_cast<Metrics&>(m), other);
+    m.queued += other.queued;
+    m.outstanding += other.outstanding;
+    m.delivered += other.delivered;
+    return m;
+}
+
+void
+IceMX::visitMetrics(const TopicMetrics& m, MetricsVisitor& visitor)
+{
+    visitMetrics(static_cast<const Metrics&>(m), visitor);
+    visitor.counter("published", m.published);
+    visitor.counter("forwarded", m.forwarded);
+}
+
+void
+IceMX::visitMetrics(const SubscriberMetrics& m, MetricsVisitor& visitor)
+{
+    visitMetrics(static_cast<const Metrics&>(m), visitor);
+    visitor.gauge("queued", m.queued);
+    visitor.gauge("outstanding", m.outstanding);
+    visitor.counter("delivered", m.delivered);
+}
+
 void
 TopicObserverI::published()
 {
@@ -257,7 +293,11 @@ struct QueuedUpdate
 void
 SubscriberObserverI::queued(int count)
 {
-    forEach(QueuedUpdate(count));
+    //
+    // The queued and outstanding gauges are decremented with a lower
+    // bound, their updates can't be applied to per-thread shards.
+    //
+    forEachUnsharded(QueuedUpdate(count));
 }
 
 namespace
@@ -286,7 +326,7 @@ struct OutstandingUpdate
 void
 SubscriberObserverI::outstanding(int count)
 {
-    forEach(OutstandingUpdate(count));
+    forEachUnsharded(OutstandingUpdate(count));
 }
 
 namespace
@@ -315,7 +355,7 @@ struct DeliveredUpdate
 void
 SubscriberObserverI::delivered(int count)
 {
-    forEach(DeliveredUpdate(count));
+    forEachUnsharded(DeliveredUpdate(count));
 }
 
 TopicManagerObserverI::TopicManagerObserverI(const IceInternal::MetricsAdminIPtr& metrics) : 
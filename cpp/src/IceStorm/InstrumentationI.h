@@ -15,6 +15,16 @@
 #include <IceStorm/Instrumentation.h>
 #include <IceStorm/Metrics.h>
 
+namespace IceMX
+{
+
+TopicMetrics& mergeMetrics(TopicMetrics&, const TopicMetrics&);
+SubscriberMetrics& mergeMetrics(SubscriberMetrics&, const SubscriberMetrics&);
+void visitMetrics(const TopicMetrics&, MetricsVisitor&);
+void visitMetrics(const SubscriberMetrics&, MetricsVisitor&);
+
+}
+
 namespace IceStorm
 {
 
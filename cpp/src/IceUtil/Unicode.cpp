@@ -10,6 +10,9 @@
 #include <IceUtil/Unicode.h>
 #include <IceUtil/ConvertUTF.h>
 
+#include <algorithm>
+#include <string.h>
+
 using namespace std;
 using namespace IceUtil;
 using namespace IceUtilInternal;
@@ -79,6 +82,71 @@ struct WstringHelper<4>
             reinterpret_cast<UTF32*>(targetEnd), flags);
     }
 };
+
+//
+// Most strings exchanged by applications are plain ASCII, for which
+// the conversion is a simple widening or narrowing copy. These helpers
+// copy the leading ASCII run directly and leave the remainder (if any)
+// to the unicode.org converters. The UTF-8 scan checks one machine word
+// at a time; the copy loops are simple enough for the compiler to
+// vectorize.
+//
+const size_t wordSize = sizeof(size_t);
+
+size_t
+asciiPrefixLength(const Byte* start, const Byte* end)
+{
+    const size_t highBits = static_cast<size_t>(-1) / 0xFF * 0x80;
+    const Byte* p = start;
+    while(static_cast<size_t>(end - p) >= wordSize)
+    {
+        size_t word;
+        memcpy(&word, p, wordSize);
+        if(word & highBits)
+        {
+            break;
+        }
+        p += wordSize;
+    }
+    while(p < end && *p < 0x80)
+    {
+        ++p;
+    }
+    return static_cast<size_t>(p - start);
+}
+
+void
+copyAsciiFromUTF8(const Byte*& sourceStart, const Byte* sourceEnd, wchar_t*& targetStart, wchar_t* targetEnd)
+{
+    size_t n = std::min(asciiPrefixLength(sourceStart, sourceEnd), static_cast<size_t>(targetEnd - targetStart));
+    const Byte* source = sourceStart;
+    wchar_t* target = targetStart;
+    for(size_t i = 0; i < n; ++i)
+    {
+        target[i] = static_cast<wchar_t>(source[i]);
+    }
+    sourceStart += n;
+    targetStart += n;
+}
+
+void
+copyAsciiToUTF8(const wchar_t*& sourceStart, const wchar_t* sourceEnd, Byte*& targetStart, Byte* targetEnd)
+{
+    size_t n = std::min(static_cast<size_t>(sourceEnd - sourceStart), static_cast<size_t>(targetEnd - targetStart));
+    const wchar_t* source = sourceStart;
+    size_t i = 0;
+    while(i < n && static_cast<unsigned int>(source[i]) < 0x80)
+    {
+        ++i;
+    }
+    Byte* target = targetStart;
+    for(size_t j = 0; j < i; ++j)
+    {
+        target[j] = static_cast<Byte>(source[j]);
+    }
+    sourceStart += i;
+    targetStart += i;
+}
 }
 
 //
@@ -90,6 +158,11 @@ IceUtilInternal::convertUTFWstringToUTF8(
     const wchar_t*& sourceStart, const wchar_t* sourceEnd, 
     Byte*& targetStart, Byte* targetEnd, ConversionFlags flags)
 {
+    copyAsciiToUTF8(sourceStart, sourceEnd, targetStart, targetEnd);
+    if(sourceStart == sourceEnd)
+    {
+        return conversionOK;
+    }
     return WstringHelper<sizeof(wchar_t)>::toUTF8(
         sourceStart, sourceEnd, targetStart, targetEnd, flags);
 }
@@ -99,6 +172,11 @@ IceUtilInternal::convertUTF8ToUTFWstring(
     const Byte*& sourceStart, const Byte* sourceEnd, 
     wchar_t*& targetStart, wchar_t* targetEnd, ConversionFlags flags)
 {
+    copyAsciiFromUTF8(sourceStart, sourceEnd, targetStart, targetEnd);
+    if(sourceStart == sourceEnd)
+    {
+        return conversionOK;
+    }
     return WstringHelper<sizeof(wchar_t)>::fromUTF8(
         sourceStart, sourceEnd, targetStart, targetEnd, flags);
 }
@@ -191,6 +191,79 @@ writeDataMemberInitializers(IceUtilInternal::Output& C, const DataMemberList& me
     }
 }
 
+//
+// Returns true if the C++ layout of the given struct is identical to
+// its little-endian wire layout. The struct must only contain byte,
+// short, int, long, float and double data members or structs with the
+// same property, and each data member must be naturally aligned so
+// that the C++ compiler doesn't add any padding. The size and the
+// alignment of the struct are returned in size and alignment.
+//
+bool
+isBulkCopyable(const StructPtr& p, int& size, int& alignment)
+{
+    if(findMetaData(p->getMetaData(), false) == "%class")
+    {
+        return false;
+    }
+
+    size = 0;
+    alignment = 1;
+    DataMemberList dataMembers = p->dataMembers();
+    for(DataMemberList::const_iterator q = dataMembers.begin(); q != dataMembers.end(); ++q)
+    {
+        int memberSize = 0;
+        int memberAlignment = 0;
+        BuiltinPtr builtin = BuiltinPtr::dynamicCast((*q)->type());
+        StructPtr st = StructPtr::dynamicCast((*q)->type());
+        if(builtin)
+        {
+            switch(builtin->kind())
+            {
+                case Builtin::KindByte:
+                {
+                    memberSize = 1;
+                    break;
+                }
+                case Builtin::KindShort:
+                {
+                    memberSize = 2;
+                    break;
+                }
+                case Builtin::KindInt:
+                case Builtin::KindFloat:
+                {
+                    memberSize = 4;
+                    break;
+                }
+                case Builtin::KindLong:
+                case Builtin::KindDouble:
+                {
+                    memberSize = 8;
+                    break;
+                }
+                default:
+                {
+                    return false;
+                }
+            }
+            memberAlignment = memberSize;
+        }
+        else if(!st || !isBulkCopyable(st, memberSize, memberAlignment))
+        {
+            return false;
+        }
+
+        if(size % memberAlignment != 0)
+        {
+            return false;
+        }
+        size += memberSize;
+        alignment = max(alignment, memberAlignment);
+    }
+    return size > 0 && size % alignment == 0;
+}
+
 }
 
 Slice::Gen::Gen(const string& base, const string& headerExtension, const string& sourceExtension,
@@ -5144,6 +5217,17 @@ Slice::Gen::StreamVisitor::visitStructStart(const StructPtr& p)
         }
         H << eb << ";" << nl;
 
+        int size;
+        int alignment;
+        if(isBulkCopyable(p, size, alignment))
+        {
+            H << nl << "template<>";
+            H << nl << "struct StreamBulkCopyable< " << fullStructName << ">";
+            H << sb;
+            H << nl << "static const bool value = true;";
+            H << eb << ";" << nl;
+        }
+
         DataMemberList dataMembers = p->dataMembers();
 
         string holder = classMetaData ? "v->" : "v.";
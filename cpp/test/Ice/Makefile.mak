@@ -36,7 +36,10 @@ SUBDIRS		= proxy \
 		  metrics \
 		  optional \
 		  enums \
-		  echo
+		  echo \
+		  tracing \
+		  coalesce \
+		  bench
 
 !if "$(WINRT)" != "yes"
 SUBDIRS		= $(SUBDIRS) \
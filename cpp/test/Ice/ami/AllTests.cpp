@@ -17,6 +17,20 @@ using namespace std;
 namespace
 {
 
+//
+// Returns a payload filled with random data. The tests which fill the
+// socket buffers use a new payload for each request, the requests must
+// not shrink if the transport compresses them (WebSocket
+// permessage-deflate), including against the previous requests.
+//
+Ice::ByteSeq
+createPayload(size_t size)
+{
+    Ice::ByteSeq seq(size);
+    IceUtilInternal::generateRandom(reinterpret_cast<char*>(&seq[0]), seq.size());
+    return seq;
+}
+
 struct Cookie : public Ice::LocalObject
 {
     Cookie(int i) : val(i)
@@ -1504,13 +1518,11 @@ allTests(const Ice::CommunicatorPtr& communicator, bool collocated)
         cbWC->check();
 
         vector<SentCallbackPtr> cbs;
-        Ice::ByteSeq seq;
-        seq.resize(1024);
         testController->holdAdapter();
         try
         {
             cb = new SentCallback();
-            while(p->begin_opWithPayload(seq, Test::newCallback_TestIntf_opWithPayload(
+            while(p->begin_opWithPayload(createPayload(1024), Test::newCallback_TestIntf_opWithPayload(
                                              cb, &SentCallback::ex, &SentCallback::sent))->sentSynchronously())
             {
                 cbs.push_back(cb);
@@ -1572,13 +1584,11 @@ allTests(const Ice::CommunicatorPtr& communicator, bool collocated)
         cb->check();
 
         vector<SentCallbackPtr> cbs;
-        Ice::ByteSeq seq;
-        seq.resize(1024);
         testController->holdAdapter();
         try
         {
             cb = new SentCallback();
-            while(p->begin_opWithPayload(seq, nullptr, [=](const Ice::Exception& ex){ cb->ex(ex); },
+            while(p->begin_opWithPayload(createPayload(1024), nullptr, [=](const Ice::Exception& ex){ cb->ex(ex); },
                                                        [=](bool sent){ cb->sent(sent); })->sentSynchronously())
             {
                 cbs.push_back(cb);
@@ -2611,9 +2621,7 @@ allTests(const Ice::CommunicatorPtr& communicator, bool collocated)
             try
             {
                 r1 = p->begin_op();
-                Ice::ByteSeq seq;
-                seq.resize(1024);
-                while((r2 = p->begin_opWithPayload(seq))->sentSynchronously());
+                while((r2 = p->begin_opWithPayload(createPayload(1024)))->sentSynchronously());
 
                 test(r1 == r1);
                 test(r1 != r2);
@@ -2721,11 +2729,9 @@ allTests(const Ice::CommunicatorPtr& communicator, bool collocated)
             testController->holdAdapter();
 
             Ice::AsyncResultPtr r;
-            Ice::ByteSeq seq;
-            seq.resize(10024);
             for(int i = 0; i < 200; ++i) // 2MB
             {
-                r = p->begin_opWithPayload(seq);
+                r = p->begin_opWithPayload(createPayload(10024));
             }
 
             test(!r->isSent());
@@ -2788,12 +2794,7 @@ allTests(const Ice::CommunicatorPtr& communicator, bool collocated)
     {
         cout << "testing close connection with sending queue... " << flush;
         {
-            Ice::ByteSeq seq;
-            seq.resize(1024 * 10);
-            for(Ice::ByteSeq::iterator q = seq.begin(); q != seq.end(); ++q)
-            {
-                *q = static_cast<Ice::Byte>(IceUtilInternal::random(255));
-            }
+            Ice::ByteSeq seq = createPayload(1024 * 10);
 
             //
             // Send multiple opWithPayload, followed by a close and followed by multiple opWithPaylod.
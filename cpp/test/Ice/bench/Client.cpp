@@ -0,0 +1,534 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <IceUtil/Thread.h>
+#include <TestCommon.h>
+#include <TestI.h>
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+DEFINE_TEST("client")
+
+using namespace std;
+using namespace Test;
+
+//
+// The benchmark client. It invokes the configured operation on the
+// bench object from Bench.Threads threads for Bench.Duration seconds,
+// after a Bench.Warmup seconds warmup, and prints the results as a
+// JSON object on a single line. The results are also appended to the
+// Bench.Output file if it's set.
+//
+// Bench.Operation   ping, send, recv, echo or graph (default ping)
+// Bench.Mode        twoway, oneway, batch or ami (default twoway)
+// Bench.PayloadSize the size of the sent or received byte sequence,
+//                   or the number of nodes of the received graph
+// Bench.Threads     the number of invoking threads (default 1)
+// Bench.Pipeline    the maximum number of outstanding AMI requests per
+//                   thread (default 16)
+// Bench.BatchSize   the number of batch requests per flush (default 100)
+// Bench.Collocated  invoke on a servant of the client's communicator
+// Bench.Proxy       the bench object (default bench:default -p 12010)
+// Bench.Name        the benchmark name included with the results
+//
+// Latencies are only measured for twoway and AMI requests and are in
+// microseconds. Megabytes are 10^6 bytes.
+//
+
+namespace
+{
+
+struct Config
+{
+    string operation;
+    string mode;
+    Ice::Int payloadSize;
+    int threads;
+    int pipeline;
+    int batchSize;
+    IceUtil::Time start;
+    IceUtil::Time end;
+};
+
+IceUtil::Time
+now()
+{
+    return IceUtil::Time::now(IceUtil::Time::Monotonic);
+}
+
+class RequestStart : public Ice::LocalObject
+{
+public:
+
+    RequestStart(const IceUtil::Time& t) : time(t)
+    {
+    }
+
+    const IceUtil::Time time;
+};
+typedef IceUtil::Handle<RequestStart> RequestStartPtr;
+
+class BenchThread : public IceUtil::Thread, private IceUtil::Monitor<IceUtil::Mutex>
+{
+public:
+
+    BenchThread(const BenchPrx& proxy, const Config& config) :
+        _proxy(proxy),
+        _config(config),
+        _payload(config.payloadSize),
+        _bytes(_payload.empty() ? static_cast<const Ice::Byte*>(0) : &_payload[0],
+               _payload.empty() ? static_cast<const Ice::Byte*>(0) : &_payload[0] + _payload.size()),
+        _requests(0),
+        _outstanding(0)
+    {
+    }
+
+    virtual void
+    run()
+    {
+        try
+        {
+            if(_config.mode == "ami")
+            {
+                runAsync();
+            }
+            else
+            {
+                runSync();
+            }
+        }
+        catch(const Ice::Exception& ex)
+        {
+            ostringstream os;
+            os << ex;
+            _error = os.str();
+        }
+    }
+
+    void
+    completed(const Ice::AsyncResultPtr& result)
+    {
+        IceUtil::Time t;
+        try
+        {
+            BenchPrx proxy = BenchPrx::uncheckedCast(result->getProxy());
+            if(_config.operation == "ping")
+            {
+                proxy->end_ping(result);
+            }
+            else if(_config.operation == "send")
+            {
+                proxy->end_send(result);
+            }
+            else if(_config.operation == "recv")
+            {
+                proxy->end_recv(result);
+            }
+            else if(_config.operation == "graph")
+            {
+                proxy->end_graph(result);
+            }
+            else
+            {
+                proxy->end_echo(result);
+            }
+            t = now();
+        }
+        catch(const Ice::Exception& ex)
+        {
+            ostringstream os;
+            os << ex;
+            Lock sync(*this);
+            _error = os.str();
+        }
+
+        IceUtil::Time started = RequestStartPtr::dynamicCast(result->getCookie())->time;
+
+        Lock sync(*this);
+        if(started >= _config.start && t != IceUtil::Time())
+        {
+            ++_requests;
+            _latencies.push_back((t - started).toMicroSeconds());
+            _last = t;
+        }
+        --_outstanding;
+        notify();
+    }
+
+    Ice::Long
+    requests() const
+    {
+        return _requests;
+    }
+
+    const IceUtil::Time&
+    last() const
+    {
+        return _last;
+    }
+
+    const vector<Ice::Long>&
+    latencies() const
+    {
+        return _latencies;
+    }
+
+    const string&
+    error() const
+    {
+        return _error;
+    }
+
+private:
+
+    void
+    invoke(const BenchPrx& proxy)
+    {
+        if(_config.operation == "ping")
+        {
+            proxy->ping();
+        }
+        else if(_config.operation == "send")
+        {
+            proxy->send(_bytes);
+        }
+        else if(_config.operation == "recv")
+        {
+            proxy->recv(_config.payloadSize);
+        }
+        else if(_config.operation == "graph")
+        {
+            proxy->graph(_config.payloadSize);
+        }
+        else
+        {
+            proxy->echo(_payload);
+        }
+    }
+
+    void
+    runSync()
+    {
+        BenchPrx proxy = _proxy;
+        if(_config.mode == "oneway")
+        {
+            proxy = _proxy->ice_oneway();
+        }
+        else if(_config.mode == "batch")
+        {
+            proxy = _proxy->ice_batchOneway();
+        }
+        const bool twoway = _config.mode == "twoway";
+
+        int batched = 0;
+        while(true)
+        {
+            IceUtil::Time t = now();
+            if(t >= _config.end)
+            {
+                break;
+            }
+
+            invoke(proxy);
+
+            if(_config.mode == "batch" && ++batched == _config.batchSize)
+            {
+                proxy->ice_flushBatchRequests();
+                batched = 0;
+            }
+
+            if(t >= _config.start)
+            {
+                ++_requests;
+                if(twoway)
+                {
+                    _last = now();
+                    _latencies.push_back((_last - t).toMicroSeconds());
+                }
+            }
+        }
+
+        if(!twoway)
+        {
+            //
+            // Oneway requests are done once they're sent. A twoway request
+            // on the same connection ensures the server received them.
+            //
+            if(batched > 0)
+            {
+                proxy->ice_flushBatchRequests();
+            }
+            _proxy->ice_ping();
+            _last = now();
+        }
+    }
+
+    void
+    runAsync()
+    {
+        Ice::CallbackPtr cb = Ice::newCallback(this, &BenchThread::completed);
+        while(true)
+        {
+            {
+                Lock sync(*this);
+                while(_outstanding >= _config.pipeline)
+                {
+                    wait();
+                }
+                ++_outstanding;
+            }
+
+            IceUtil::Time t = now();
+            if(t >= _config.end)
+            {
+                Lock sync(*this);
+                --_outstanding;
+                break;
+            }
+
+            RequestStartPtr cookie = new RequestStart(t);
+            if(_config.operation == "ping")
+            {
+                _proxy->begin_ping(cb, cookie);
+            }
+            else if(_config.operation == "send")
+            {
+                _proxy->begin_send(_bytes, cb, cookie);
+            }
+            else if(_config.operation == "recv")
+            {
+                _proxy->begin_recv(_config.payloadSize, cb, cookie);
+            }
+            else if(_config.operation == "graph")
+            {
+                _proxy->begin_graph(_config.payloadSize, cb, cookie);
+            }
+            else
+            {
+                _proxy->begin_echo(_payload, cb, cookie);
+            }
+        }
+
+        Lock sync(*this);
+        while(_outstanding > 0)
+        {
+            wait();
+        }
+    }
+
+    const BenchPrx _proxy;
+    const Config _config;
+    const ByteSeq _payload;
+    const pair<const Ice::Byte*, const Ice::Byte*> _bytes;
+    Ice::Long _requests;
+    IceUtil::Time _last;
+    vector<Ice::Long> _latencies;
+    int _outstanding;
+    string _error;
+};
+typedef IceUtil::Handle<BenchThread> BenchThreadPtr;
+
+Ice::Long
+percentile(const vector<Ice::Long>& sorted, double q)
+{
+    size_t n = static_cast<size_t>(q * static_cast<double>(sorted.size()));
+    return sorted[min(n, sorted.size() - 1)];
+}
+
+}
+
+int
+run(int, char**, const Ice::CommunicatorPtr& communicator)
+{
+    Ice::PropertiesPtr properties = communicator->getProperties();
+
+    Config config;
+    config.operation = properties->getPropertyWithDefault("Bench.Operation", "ping");
+    config.mode = properties->getPropertyWithDefault("Bench.Mode", "twoway");
+    config.payloadSize = max(properties->getPropertyAsInt("Bench.PayloadSize"), 0);
+    config.threads = max(properties->getPropertyAsIntWithDefault("Bench.Threads", 1), 1);
+    config.pipeline = max(properties->getPropertyAsIntWithDefault("Bench.Pipeline", 16), 1);
+    config.batchSize = max(properties->getPropertyAsIntWithDefault("Bench.BatchSize", 100), 1);
+    const bool collocated = properties->getPropertyAsInt("Bench.Collocated") > 0;
+
+    if(config.operation != "ping" && config.operation != "send" && config.operation != "recv" &&
+       config.operation != "echo" && config.operation != "graph")
+    {
+        cerr << "invalid Bench.Operation `" << config.operation << "'" << endl;
+        return EXIT_FAILURE;
+    }
+    if(config.mode != "twoway" && config.mode != "oneway" && config.mode != "batch" && config.mode != "ami")
+    {
+        cerr << "invalid Bench.Mode `" << config.mode << "'" << endl;
+        return EXIT_FAILURE;
+    }
+    if((config.mode == "oneway" || config.mode == "batch") && config.operation != "ping" && config.operation != "send")
+    {
+        cerr << "operation `" << config.operation << "' can't be invoked with " << config.mode << " requests" << endl;
+        return EXIT_FAILURE;
+    }
+
+    BenchPrx remote = BenchPrx::checkedCast(
+        communicator->stringToProxy(properties->getPropertyWithDefault("Bench.Proxy", "bench:default -p 12010")));
+    test(remote);
+
+    BenchPrx bench = remote;
+    string transport;
+    if(collocated)
+    {
+        communicator->getProperties()->setProperty("CollocatedAdapter.Endpoints", "tcp -h 127.0.0.1");
+        Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapter("CollocatedAdapter");
+        bench = BenchPrx::uncheckedCast(adapter->add(new BenchI, communicator->stringToIdentity("bench")));
+        adapter->activate();
+        transport = "collocated";
+    }
+    else
+    {
+        string endpoint = bench->ice_getEndpoints()[0]->toString();
+        transport = endpoint.substr(0, endpoint.find(' '));
+    }
+
+    config.start = now() + IceUtil::Time::secondsDouble(
+        atof(properties->getPropertyWithDefault("Bench.Warmup", "1").c_str()));
+    config.end = config.start + IceUtil::Time::secondsDouble(
+        atof(properties->getPropertyWithDefault("Bench.Duration", "5").c_str()));
+
+    vector<BenchThreadPtr> threads;
+    for(int i = 0; i < config.threads; ++i)
+    {
+        BenchThreadPtr thread = new BenchThread(bench, config);
+        thread->start();
+        threads.push_back(thread);
+    }
+
+    Ice::Long requests = 0;
+    IceUtil::Time last = config.end;
+    vector<Ice::Long> latencies;
+    for(vector<BenchThreadPtr>::const_iterator p = threads.begin(); p != threads.end(); ++p)
+    {
+        (*p)->getThreadControl().join();
+        if(!(*p)->error().empty())
+        {
+            cerr << (*p)->error() << endl;
+            return EXIT_FAILURE;
+        }
+        requests += (*p)->requests();
+        last = max(last, (*p)->last());
+        latencies.insert(latencies.end(), (*p)->latencies().begin(), (*p)->latencies().end());
+    }
+
+    Ice::Long bytes = 0;
+    if(config.operation == "send" || config.operation == "recv")
+    {
+        bytes = config.payloadSize;
+    }
+    else if(config.operation == "echo")
+    {
+        bytes = 2 * static_cast<Ice::Long>(config.payloadSize);
+    }
+
+    double seconds = (last - config.start).toSecondsDouble();
+
+    ostringstream os;
+    os << fixed << setprecision(3);
+    os << "{\"name\":\"" << properties->getPropertyWithDefault("Bench.Name", config.operation) << "\""
+       << ",\"transport\":\"" << transport << "\""
+       << ",\"operation\":\"" << config.operation << "\""
+       << ",\"mode\":\"" << config.mode << "\""
+       << ",\"payloadSize\":" << config.payloadSize
+       << ",\"threads\":" << config.threads;
+    if(config.mode == "ami")
+    {
+        os << ",\"pipeline\":" << config.pipeline;
+    }
+    else if(config.mode == "batch")
+    {
+        os << ",\"batchSize\":" << config.batchSize;
+    }
+    os << ",\"requests\":" << requests
+       << ",\"seconds\":" << seconds
+       << ",\"requestsPerSecond\":" << static_cast<double>(requests) / seconds
+       << ",\"megabytesPerSecond\":" << static_cast<double>(requests * bytes) / seconds / 1000000.0;
+    if(!latencies.empty())
+    {
+        sort(latencies.begin(), latencies.end());
+        double sum = 0;
+        for(vector<Ice::Long>::const_iterator p = latencies.begin(); p != latencies.end(); ++p)
+        {
+            sum += static_cast<double>(*p);
+        }
+        os << ",\"latency\":{\"mean\":" << sum / static_cast<double>(latencies.size())
+           << ",\"p50\":" << percentile(latencies, 0.5)
+           << ",\"p90\":" << percentile(latencies, 0.9)
+           << ",\"p99\":" << percentile(latencies, 0.99)
+           << ",\"p999\":" << percentile(latencies, 0.999)
+           << ",\"max\":" << latencies.back() << "}";
+    }
+    os << "}";
+
+    cout << os.str() << endl;
+
+    string output = properties->getProperty("Bench.Output");
+    if(!output.empty())
+    {
+        ofstream out(output.c_str(), ios_base::app);
+        if(!out)
+        {
+            cerr << "cannot open `" << output << "'" << endl;
+            return EXIT_FAILURE;
+        }
+        out << os.str() << endl;
+    }
+
+    if(properties->getPropertyAsIntWithDefault("Bench.Shutdown", 1) > 0)
+    {
+        remote->shutdown();
+    }
+    return EXIT_SUCCESS;
+}
+
+int
+main(int argc, char* argv[])
+{
+    int status;
+    Ice::CommunicatorPtr communicator;
+
+    try
+    {
+        Ice::InitializationData initData;
+        initData.properties = Ice::createProperties(argc, argv);
+        Ice::StringSeq args = Ice::argsToStringSeq(argc, argv);
+        args = initData.properties->parseCommandLineOptions("Bench", args);
+        Ice::stringSeqToArgs(args, argc, argv);
+        communicator = Ice::initialize(argc, argv, initData);
+        status = run(argc, argv, communicator);
+    }
+    catch(const Ice::Exception& ex)
+    {
+        cerr << ex << endl;
+        status = EXIT_FAILURE;
+    }
+
+    if(communicator)
+    {
+        try
+        {
+            communicator->destroy();
+        }
+        catch(const Ice::Exception& ex)
+        {
+            cerr << ex << endl;
+            status = EXIT_FAILURE;
+        }
+    }
+
+    return status;
+}
@@ -0,0 +1,90 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <TestAMDI.h>
+
+using namespace std;
+
+namespace
+{
+
+//
+// Returns a list of size nodes where each node after the first also
+// references the first node. Servants keep the graph, so requests only
+// measure its marshaling.
+//
+Test::NodePtr
+createGraph(Ice::Int size)
+{
+    Test::NodePtr first;
+    Test::NodePtr last;
+    for(Ice::Int i = 0; i < size; ++i)
+    {
+        Test::NodePtr node = new Test::Node(i, 0, first);
+        if(last)
+        {
+            last->next = node;
+        }
+        else
+        {
+            first = node;
+        }
+        last = node;
+    }
+    return first;
+}
+
+}
+
+void
+BenchI::ping_async(const Test::AMD_Bench_pingPtr& cb, const Ice::Current&)
+{
+    cb->ice_response();
+}
+
+void
+BenchI::send_async(const Test::AMD_Bench_sendPtr& cb, const Test::ByteSeq&, const Ice::Current&)
+{
+    cb->ice_response();
+}
+
+void
+BenchI::recv_async(const Test::AMD_Bench_recvPtr& cb, Ice::Int size, const Ice::Current&)
+{
+    cb->ice_response(Test::ByteSeq(size));
+}
+
+void
+BenchI::echo_async(const Test::AMD_Bench_echoPtr& cb, const Test::ByteSeq& seq, const Ice::Current&)
+{
+    cb->ice_response(seq);
+}
+
+void
+BenchI::graph_async(const Test::AMD_Bench_graphPtr& cb, Ice::Int size, const Ice::Current&)
+{
+    Test::NodePtr graph;
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        if(!_graph || _graphSize != size)
+        {
+            _graph = createGraph(size);
+            _graphSize = size;
+        }
+        graph = _graph;
+    }
+    cb->ice_response(graph);
+}
+
+void
+BenchI::shutdown(const Ice::Current& current)
+{
+    current.adapter->getCommunicator()->shutdown();
+}
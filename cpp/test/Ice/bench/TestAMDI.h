@@ -0,0 +1,43 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef TEST_AMD_I_H
+#define TEST_AMD_I_H
+
+#include <TestAMD.h>
+#include <IceUtil/Mutex.h>
+
+class BenchI : public Test::Bench
+{
+public:
+
+    BenchI() : _graphSize(0)
+    {
+    }
+
+    virtual void ping_async(const Test::AMD_Bench_pingPtr&, const Ice::Current&);
+
+    virtual void send_async(const Test::AMD_Bench_sendPtr&, const Test::ByteSeq&, const Ice::Current&);
+
+    virtual void recv_async(const Test::AMD_Bench_recvPtr&, Ice::Int, const Ice::Current&);
+
+    virtual void echo_async(const Test::AMD_Bench_echoPtr&, const Test::ByteSeq&, const Ice::Current&);
+
+    virtual void graph_async(const Test::AMD_Bench_graphPtr&, Ice::Int, const Ice::Current&);
+
+    virtual void shutdown(const Ice::Current&);
+
+private:
+
+    IceUtil::Mutex _mutex;
+    Test::NodePtr _graph;
+    Ice::Int _graphSize;
+};
+
+#endif
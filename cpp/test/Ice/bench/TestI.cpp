@@ -0,0 +1,84 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <TestI.h>
+
+using namespace std;
+
+namespace
+{
+
+//
+// Returns a list of size nodes where each node after the first also
+// references the first node. Servants keep the graph, so requests only
+// measure its marshaling.
+//
+Test::NodePtr
+createGraph(Ice::Int size)
+{
+    Test::NodePtr first;
+    Test::NodePtr last;
+    for(Ice::Int i = 0; i < size; ++i)
+    {
+        Test::NodePtr node = new Test::Node(i, 0, first);
+        if(last)
+        {
+            last->next = node;
+        }
+        else
+        {
+            first = node;
+        }
+        last = node;
+    }
+    return first;
+}
+
+}
+
+void
+BenchI::ping(const Ice::Current&)
+{
+}
+
+void
+BenchI::send(const pair<const Ice::Byte*, const Ice::Byte*>&, const Ice::Current&)
+{
+}
+
+Test::ByteSeq
+BenchI::recv(Ice::Int size, const Ice::Current&)
+{
+    return Test::ByteSeq(size);
+}
+
+Test::ByteSeq
+BenchI::echo(const Test::ByteSeq& seq, const Ice::Current&)
+{
+    return seq;
+}
+
+Test::NodePtr
+BenchI::graph(Ice::Int size, const Ice::Current&)
+{
+    IceUtil::Mutex::Lock sync(_mutex);
+    if(!_graph || _graphSize != size)
+    {
+        _graph = createGraph(size);
+        _graphSize = size;
+    }
+    return _graph;
+}
+
+void
+BenchI::shutdown(const Ice::Current& current)
+{
+    current.adapter->getCommunicator()->shutdown();
+}
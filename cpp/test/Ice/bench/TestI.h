@@ -0,0 +1,45 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef TEST_I_H
+#define TEST_I_H
+
+#include <Test.h>
+#include <IceUtil/Mutex.h>
+
+class BenchI : public Test::Bench
+{
+public:
+
+    BenchI() : _graphSize(0)
+    {
+    }
+
+    virtual void ping(const Ice::Current&);
+
+    virtual void send(const std::pair<const Ice::Byte*, const Ice::Byte*>&, const Ice::Current&);
+
+    virtual Test::ByteSeq recv(Ice::Int, const Ice::Current&);
+
+    virtual Test::ByteSeq echo(const Test::ByteSeq&, const Ice::Current&);
+
+    virtual Test::NodePtr graph(Ice::Int, const Ice::Current&);
+
+    virtual void shutdown(const Ice::Current&);
+
+private:
+
+    Test::ByteSeq _seq;
+
+    IceUtil::Mutex _mutex;
+    Test::NodePtr _graph;
+    Ice::Int _graphSize;
+};
+
+#endif
@@ -0,0 +1,91 @@
+#!/usr/bin/env python
+# **********************************************************************
+#
+# Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+#
+# This copy of Ice is licensed to you under the terms described in the
+# ICE_LICENSE file included in this distribution.
+#
+# **********************************************************************
+
+import os, sys, json
+
+path = [ ".", "..", "../..", "../../..", "../../../..", "../../../../.." ]
+head = os.path.dirname(sys.argv[0])
+if len(head) > 0:
+    path = [os.path.join(head, p) for p in path]
+path = [os.path.abspath(p) for p in path if os.path.exists(os.path.join(p, "scripts", "TestUtil.py")) ]
+if len(path) == 0:
+    raise RuntimeError("can't find toplevel directory!")
+sys.path.append(os.path.join(path[0], "scripts"))
+import TestUtil
+
+#
+# Runs the benchmarks with each transport and appends the results to
+# bench.json, one JSON object per line. The benchmarks run over tcp
+# and ws by default or over ssl and wss with --protocol=ssl. Other
+# client properties can be set with --arg, for example
+# --arg=--Bench.Duration=10, these override the defaults below.
+#
+output = os.path.join(os.getcwd(), "bench.json")
+if os.path.exists(output):
+    os.remove(output)
+
+serverOptions = "--Ice.ThreadPool.Server.Size=4 --Ice.ThreadPool.Server.SizeMax=4 --Ice.Warn.Connections=0"
+clientOptions = "--Bench.Warmup=1 --Bench.Duration=2 --Bench.Output=%s" % output
+
+metricsOptions = "--Ice.Admin.Enabled=1 --IceMX.Metrics.Bench.GroupBy=operation"
+coalesceOptions = "--BenchAdapter.CoalesceReplies=200"
+
+benchmarks = [
+    # name, server, additional server options, additional client options
+    ("latency", "server", "", "--Bench.Threads=1"),
+    ("twoway", "server", "", "--Bench.Threads=4"),
+    ("oneway", "server", "", "--Bench.Mode=oneway --Bench.Threads=4"),
+    ("batch", "server", "", "--Bench.Mode=batch --Bench.Threads=4"),
+    ("ami", "server", "", "--Bench.Mode=ami --Bench.Threads=4 --Bench.Pipeline=16"),
+    ("amd", "serveramd", "", "--Bench.Threads=4"),
+    ("send-64k", "server", "", "--Bench.Operation=send --Bench.PayloadSize=65536 --Bench.Threads=4"),
+    ("recv-64k", "server", "", "--Bench.Operation=recv --Bench.PayloadSize=65536 --Bench.Threads=4"),
+    ("echo-256k", "server", "", "--Bench.Operation=echo --Bench.PayloadSize=262144 --Bench.Threads=1"),
+    ("graph-1k", "server", "", "--Bench.Operation=graph --Bench.PayloadSize=1000 --Bench.Threads=1"),
+    ("metrics", "server", metricsOptions, "--Bench.Threads=4"),
+    ("metrics-shards", "server", metricsOptions + " --IceMX.Metrics.Bench.Shards=4", "--Bench.Threads=4"),
+    ("tracing", "server", "--Ice.Tracer.Enabled=1", "--Bench.Threads=4 --Ice.Tracer.Enabled=1"),
+    ("collocated", "server", "", "--Bench.Threads=4 --Bench.Collocated=1"),
+]
+
+#
+# Pipeline depth benchmarks, a single client thread keeps the given
+# number of AMI requests outstanding on one connection with and without
+# reply coalescing.
+#
+for depth in [1, 4, 16, 64]:
+    clientArgs = "--Bench.Mode=ami --Bench.Threads=1 --Bench.Pipeline=%d" % depth
+    benchmarks.append(("pipeline-%d" % depth, "server", "", clientArgs))
+    benchmarks.append(("pipeline-%d-co" % depth, "server", coalesceOptions, clientArgs))
+
+if TestUtil.protocol in ["ssl", "wss"]:
+    protocols = ["ssl", "wss"]
+else:
+    protocols = ["tcp", "ws"]
+
+for protocol in protocols:
+    TestUtil.protocol = protocol
+    for (name, server, serverArgs, clientArgs) in benchmarks:
+        if name == "collocated" and protocol != protocols[0]:
+            continue
+        print("running %s benchmark over %s." % (name, protocol))
+        TestUtil.clientServerTest(server = server,
+                                  additionalServerOptions = serverOptions + " " + serverArgs,
+                                  additionalClientOptions = "%s --Bench.Name=%s %s %s" %
+                                    (clientOptions, name, clientArgs, " ".join(TestUtil.extraArgs)))
+
+print("")
+print("%-16s %-11s %14s %10s %10s %10s" % ("benchmark", "transport", "requests/s", "MB/s", "p50 (us)", "p99 (us)"))
+for line in open(output):
+    r = json.loads(line)
+    latency = r.get("latency", {})
+    print("%-16s %-11s %14.0f %10.1f %10s %10s" % (r["name"], r["transport"], r["requestsPerSecond"],
+                                                    r["megabytesPerSecond"], latency.get("p50", "-"),
+                                                    latency.get("p99", "-")))
@@ -26,6 +26,76 @@ struct RandomNumberGenerator : public std::unary_function<ptrdiff_t, ptrdiff_t>
     }
 };
 
+//
+// Counts the endpoint host lookups, an endpoint lookup observer is only
+// requested when the addresses of the host aren't cached.
+//
+class LookupCounterI : public Ice::Instrumentation::CommunicatorObserver, public IceUtil::Mutex
+{
+public:
+
+    LookupCounterI() : _count(0)
+    {
+    }
+
+    virtual Ice::Instrumentation::ObserverPtr
+    getConnectionEstablishmentObserver(const Ice::EndpointPtr&, const string&)
+    {
+        return 0;
+    }
+
+    virtual Ice::Instrumentation::ObserverPtr
+    getEndpointLookupObserver(const Ice::EndpointPtr&)
+    {
+        IceUtil::Mutex::Lock sync(*this);
+        ++_count;
+        return 0;
+    }
+
+    virtual Ice::Instrumentation::ConnectionObserverPtr
+    getConnectionObserver(const Ice::ConnectionInfoPtr&, const Ice::EndpointPtr&,
+                          Ice::Instrumentation::ConnectionState, const Ice::Instrumentation::ConnectionObserverPtr&)
+    {
+        return 0;
+    }
+
+    virtual Ice::Instrumentation::ThreadObserverPtr
+    getThreadObserver(const string&, const string&, Ice::Instrumentation::ThreadState,
+                      const Ice::Instrumentation::ThreadObserverPtr&)
+    {
+        return 0;
+    }
+
+    virtual Ice::Instrumentation::InvocationObserverPtr
+    getInvocationObserver(const Ice::ObjectPrx&, const string&, const Ice::Context&)
+    {
+        return 0;
+    }
+
+    virtual Ice::Instrumentation::DispatchObserverPtr
+    getDispatchObserver(const Ice::Current&, Ice::Int)
+    {
+        return 0;
+    }
+
+    virtual void
+    setObserverUpdater(const Ice::Instrumentation::ObserverUpdaterPtr&)
+    {
+    }
+
+    int
+    count()
+    {
+        IceUtil::Mutex::Lock sync(*this);
+        return _count;
+    }
+
+private:
+
+    int _count;
+};
+typedef IceUtil::Handle<LookupCounterI> LookupCounterIPtr;
+
 class GetAdapterNameCB : public IceUtil::Shared, public IceUtil::Monitor<IceUtil::Mutex>
 {
 public:
@@ -871,6 +941,211 @@ allTests(const Ice::CommunicatorPtr& communicator)
         cout << "ok" << endl;
     }
 
+    cout << "testing host name resolution cache... " << flush;
+    {
+        LookupCounterIPtr counter = new LookupCounterI();
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.HostResolver.CacheTimeout", "1");
+        initData.properties->setProperty("Ice.HostResolver.NegativeCacheTimeout", "1");
+        initData.observer = counter;
+        Ice::CommunicatorPtr clientCommunicator = Ice::initialize(initData);
+
+        //
+        // Each connection ID requires a new connection and therefore a new
+        // resolution of the endpoint host, only the first one does a lookup.
+        // Once the cached addresses expire, the host is looked up again.
+        //
+        Ice::ObjectPrx prx = clientCommunicator->stringToProxy("communicator:default -h localhost -p 12010");
+        for(int i = 0; i < 3; ++i)
+        {
+            ostringstream os;
+            os << "cache-" << i;
+            prx->ice_connectionId(os.str())->ice_ping();
+        }
+        test(counter->count() == 1);
+
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(1500));
+        prx->ice_connectionId("cache-expired")->ice_ping();
+        test(counter->count() == 2);
+        prx->ice_connectionId("cache-expired-2")->ice_ping();
+        test(counter->count() == 2);
+
+        //
+        // Failed lookups are cached as well and must keep failing.
+        //
+        prx = clientCommunicator->stringToProxy("test:default -h unknown.invalid -p 12010");
+        for(int i = 0; i < 2; ++i)
+        {
+            ostringstream os;
+            os << "cache-" << i;
+            try
+            {
+                prx->ice_connectionId(os.str())->ice_ping();
+                test(false);
+            }
+            catch(const Ice::DNSException&)
+            {
+            }
+        }
+        test(counter->count() == 3);
+
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(1500));
+        try
+        {
+            prx->ice_connectionId("cache-expired")->ice_ping();
+            test(false);
+        }
+        catch(const Ice::DNSException&)
+        {
+        }
+        test(counter->count() == 4);
+
+        clientCommunicator->destroy();
+    }
+    cout << "ok" << endl;
+
+    cout << "testing parallel connection establishment... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.ParallelConnectDelay", "1000");
+        Ice::CommunicatorPtr clientCommunicator = Ice::initialize(initData);
+
+        vector<RemoteObjectAdapterPrx> adapters;
+        adapters.push_back(com->createObjectAdapter("Adapter91", "default"));
+        adapters.push_back(com->createObjectAdapter("Adapter92", "default"));
+        adapters.push_back(com->createObjectAdapter("Adapter93", "default"));
+
+        TestIntfPrx test = TestIntfPrx::uncheckedCast(
+            clientCommunicator->stringToProxy(createTestIntfPrx(adapters)->ice_toString()));
+        test = TestIntfPrx::uncheckedCast(test->ice_endpointSelection(Ice::Ordered));
+
+        //
+        // The first connector is given a head start so it wins the race. Once
+        // its adapter is deactivated, the connection is refused and the next
+        // connector is tried without waiting for the delay to expire.
+        //
+        IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        test(test->getAdapterName() == "Adapter91");
+        test->ice_getConnection()->close(false);
+        com->deactivateObjectAdapter(adapters[0]);
+        test(test->getAdapterName() == "Adapter92");
+        test->ice_getConnection()->close(false);
+        com->deactivateObjectAdapter(adapters[1]);
+        test(test->getAdapterName() == "Adapter93");
+        test->ice_getConnection()->close(false);
+        test(IceUtil::Time::now(IceUtil::Time::Monotonic) - start < IceUtil::Time::milliSeconds(1000));
+        com->deactivateObjectAdapter(adapters[2]);
+
+        try
+        {
+            test->getAdapterName();
+            test(false);
+        }
+        catch(const Ice::ConnectFailedException&)
+        {
+        }
+
+        clientCommunicator->destroy();
+    }
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.ParallelConnectDelay", "200");
+        initData.properties->setProperty("Ice.Override.ConnectTimeout", "10000");
+        Ice::CommunicatorPtr clientCommunicator = Ice::initialize(initData);
+
+        //
+        // The first endpoint is the endpoint of an adapter which isn't
+        // activated: the connection is accepted by the listening socket
+        // backlog but it's never validated, like a blackholed host. The
+        // attempt with the second endpoint starts once the delay expires
+        // and wins the race long before the connect timeout.
+        //
+        Ice::ObjectAdapterPtr blackhole =
+            communicator->createObjectAdapterWithEndpoints("Blackhole", "default -h 127.0.0.1");
+        RemoteObjectAdapterPrx adapter = com->createObjectAdapter("Adapter94", "default");
+
+        Ice::EndpointSeq endpoints = blackhole->getEndpoints();
+        Ice::EndpointSeq endpoints2 = adapter->getTestIntf()->ice_getEndpoints();
+        endpoints.insert(endpoints.end(), endpoints2.begin(), endpoints2.end());
+
+        TestIntfPrx test = TestIntfPrx::uncheckedCast(
+            clientCommunicator->stringToProxy(adapter->getTestIntf()->ice_endpoints(endpoints)->ice_toString()));
+        test = TestIntfPrx::uncheckedCast(test->ice_endpointSelection(Ice::Ordered));
+
+        IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        test(test->getAdapterName() == "Adapter94");
+        IceUtil::Time elapsed = IceUtil::Time::now(IceUtil::Time::Monotonic) - start;
+        test(elapsed >= IceUtil::Time::milliSeconds(200));
+        test(elapsed < IceUtil::Time::milliSeconds(5000));
+
+        com->deactivateObjectAdapter(adapter);
+        clientCommunicator->destroy();
+        blackhole->destroy();
+    }
+    cout << "ok" << endl;
+
+    cout << "testing connection pool... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.ConnectionPoolSize", "3");
+        Ice::CommunicatorPtr clientCommunicator = Ice::initialize(initData);
+
+        RemoteObjectAdapterPrx adapter = com->createObjectAdapter("Adapter101", "default");
+        TestIntfPrx test = TestIntfPrx::uncheckedCast(
+            clientCommunicator->stringToProxy(adapter->getTestIntf()->ice_toString()));
+
+        //
+        // Invocations are spread over the pooled connections in turn but
+        // the proxy connection is always the first pooled connection.
+        //
+        Ice::ConnectionPtr connection = test->ice_getConnection();
+        for(int i = 0; i < 6; ++i)
+        {
+            test(test->getAdapterName() == "Adapter101");
+            test(test->ice_getCachedConnection() == connection);
+            test(test->ice_getConnection() == connection);
+        }
+        test(test->end_ice_getConnection(test->begin_ice_getConnection()) == connection);
+
+        //
+        // The other pooled connections use the "-poolN" connection IDs.
+        //
+        set<Ice::ConnectionPtr> connections;
+        connections.insert(connection);
+        connections.insert(test->ice_connectionId("-pool1")->ice_getConnection());
+        connections.insert(test->ice_connectionId("-pool2")->ice_getConnection());
+        test(connections.size() == 3);
+
+        vector<Ice::AsyncResultPtr> results;
+        for(int i = 0; i < 6; ++i)
+        {
+            results.push_back(test->begin_getAdapterName());
+        }
+        for(vector<Ice::AsyncResultPtr>::const_iterator p = results.begin(); p != results.end(); ++p)
+        {
+            test(test->end_getAdapterName(*p) == "Adapter101");
+        }
+
+        //
+        // Closing one of the pooled connections re-establishes the pool
+        // on the next invocation.
+        //
+        test->ice_getConnection()->close(false);
+        test(test->getAdapterName() == "Adapter101");
+
+        TestIntfPrx test2 = TestIntfPrx::uncheckedCast(test->ice_connectionId("id2"));
+        test(test2->getAdapterName() == "Adapter101");
+        test(connections.find(test2->ice_getCachedConnection()) == connections.end());
+
+        com->deactivateObjectAdapter(adapter);
+        clientCommunicator->destroy();
+    }
+    cout << "ok" << endl;
+
     {
         cout << "testing ipv4 & ipv6 connections... " << flush;
 
@@ -0,0 +1,216 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <TestCommon.h>
+#include <Test.h>
+#include <algorithm>
+
+using namespace std;
+using namespace Test;
+
+namespace
+{
+
+//
+// Records the replies in the order they're received.
+//
+class Callback : public IceUtil::Shared, private IceUtil::Monitor<IceUtil::Mutex>
+{
+public:
+
+    void
+    response(Ice::Int value)
+    {
+        Lock sync(*this);
+        _replies.push_back(value);
+        notifyAll();
+    }
+
+    void
+    exception(const Ice::Exception& ex)
+    {
+        cerr << ex << endl;
+        test(false);
+    }
+
+    vector<Ice::Int>
+    waitForReplies(size_t count)
+    {
+        Lock sync(*this);
+        while(_replies.size() < count)
+        {
+            wait();
+        }
+        return _replies;
+    }
+
+    vector<Ice::Int>
+    getReplies()
+    {
+        Lock sync(*this);
+        return _replies;
+    }
+
+private:
+
+    vector<Ice::Int> _replies;
+};
+typedef IceUtil::Handle<Callback> CallbackPtr;
+
+Callback_TestIntf_opPtr
+newOpCallback(const CallbackPtr& cb)
+{
+    return newCallback_TestIntf_op(cb, &Callback::response, &Callback::exception);
+}
+
+Callback_TestIntf_opDelayedPtr
+newOpDelayedCallback(const CallbackPtr& cb)
+{
+    return newCallback_TestIntf_opDelayed(cb, &Callback::response, &Callback::exception);
+}
+
+Ice::ByteSeq
+createPayload(size_t size)
+{
+    Ice::ByteSeq seq(size);
+    for(size_t i = 0; i < seq.size(); ++i)
+    {
+        seq[i] = static_cast<Ice::Byte>(i);
+    }
+    return seq;
+}
+
+}
+
+TestIntfPrx
+allTests(const Ice::CommunicatorPtr& communicator)
+{
+    TestIntfPrx test = TestIntfPrx::checkedCast(communicator->stringToProxy("test:default -p 12010"));
+    test(test);
+
+    cout << "testing interleaved replies... " << flush;
+    {
+        //
+        // The replies of op are coalesced while the opDelayed requests are
+        // dispatched. The delayed replies are coalesced with the reply of
+        // releaseDelayed, they must be received in the order the server
+        // sent them.
+        //
+        CallbackPtr delayedCb = new Callback();
+        CallbackPtr opCb = new Callback();
+        for(int i = 0; i < 10; ++i)
+        {
+            test->begin_opDelayed(i, newOpDelayedCallback(delayedCb));
+            test->begin_op(100 + i, newOpCallback(opCb));
+        }
+        vector<Ice::Int> replies = opCb->waitForReplies(10);
+        for(int i = 0; i < 10; ++i)
+        {
+            test(replies[i] == 100 + i);
+        }
+        test(delayedCb->getReplies().empty());
+
+        Ice::IntSeq values = test->releaseDelayed(10, true);
+        replies = delayedCb->waitForReplies(10);
+        test(replies == values);
+        sort(values.begin(), values.end());
+        for(int i = 0; i < 10; ++i)
+        {
+            test(values[i] == i);
+        }
+    }
+    cout << "ok" << endl;
+
+    cout << "testing coalesce window... " << flush;
+    {
+        CallbackPtr delayedCb = new Callback();
+        test->begin_opDelayed(0, newOpDelayedCallback(delayedCb));
+
+        //
+        // The reply is sent once the window expires since the opDelayed
+        // request is still dispatched.
+        //
+        IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        test(test->op(1) == 1);
+        test(IceUtil::Time::now(IceUtil::Time::Monotonic) - start >= IceUtil::Time::milliSeconds(100));
+        test(delayedCb->getReplies().empty());
+
+        test->releaseDelayed(1, false);
+        test(delayedCb->waitForReplies(1)[0] == 0);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing large and compressed replies... " << flush;
+    {
+        CallbackPtr delayedCb = new Callback();
+        CallbackPtr opCb = new Callback();
+        test->begin_opDelayed(0, newOpDelayedCallback(delayedCb));
+
+        //
+        // A large reply isn't coalesced, the coalesced replies are sent
+        // first without waiting for the window to expire.
+        //
+        test->begin_op(1, newOpCallback(opCb));
+        Ice::ByteSeq seq = createPayload(10 * 1024);
+        test(test->echo(seq) == seq);
+        vector<Ice::Int> replies = opCb->getReplies();
+        test(replies.size() == 1 && replies[0] == 1);
+
+        //
+        // Same for a compressed reply.
+        //
+        TestIntfPrx compressed = test->ice_compress(true);
+        test(compressed->ice_getConnection() == test->ice_getConnection());
+        test->begin_op(2, newOpCallback(opCb));
+        seq = Ice::ByteSeq(512, 0);
+        test(compressed->echo(seq) == seq);
+        replies = opCb->getReplies();
+        test(replies.size() == 2 && replies[1] == 2);
+
+        test(delayedCb->getReplies().empty());
+        test->releaseDelayed(1, false);
+        test(delayedCb->waitForReplies(1)[0] == 0);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing graceful close with coalesced replies... " << flush;
+    {
+        CallbackPtr delayedCb = new Callback();
+        CallbackPtr opCb = new Callback();
+        Ice::ConnectionPtr connection = test->ice_getConnection();
+        test->begin_opDelayed(0, newOpDelayedCallback(delayedCb));
+        test->begin_op(1, newOpCallback(opCb));
+
+        //
+        // The server closes the connection gracefully once the coalesced
+        // replies are sent.
+        //
+        test->closeConnection(1);
+        test(delayedCb->waitForReplies(1)[0] == 0);
+        test(opCb->waitForReplies(1)[0] == 1);
+        while(true)
+        {
+            try
+            {
+                connection->getInfo();
+                IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(10));
+            }
+            catch(const Ice::CloseConnectionException&)
+            {
+                break;
+            }
+        }
+        test(test->op(2) == 2);
+        test(test->ice_getConnection() != connection);
+    }
+    cout << "ok" << endl;
+
+    return test;
+}
@@ -0,0 +1,84 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <TestI.h>
+
+using namespace std;
+
+Ice::Int
+TestI::op(Ice::Int value, const Ice::Current&)
+{
+    return value;
+}
+
+void
+TestI::opDelayed_async(const Test::AMD_TestIntf_opDelayedPtr& cb, Ice::Int value, const Ice::Current&)
+{
+    Lock sync(*this);
+    _delayed.push_back(make_pair(cb, value));
+    notifyAll();
+}
+
+Ice::ByteSeq
+TestI::echo(const Ice::ByteSeq& seq, const Ice::Current&)
+{
+    return seq;
+}
+
+Ice::IntSeq
+TestI::releaseDelayed(Ice::Int count, bool reverse, const Ice::Current&)
+{
+    //
+    // The requests sent by the client before this request might still
+    // be dispatched by other threads of the thread pool.
+    //
+    vector<pair<Test::AMD_TestIntf_opDelayedPtr, Ice::Int> > delayed;
+    {
+        Lock sync(*this);
+        while(_delayed.size() < static_cast<size_t>(count))
+        {
+            wait();
+        }
+        delayed.swap(_delayed);
+    }
+    if(reverse)
+    {
+        std::reverse(delayed.begin(), delayed.end());
+    }
+
+    //
+    // The replies are coalesced with the reply of this request.
+    //
+    Ice::IntSeq values;
+    for(vector<pair<Test::AMD_TestIntf_opDelayedPtr, Ice::Int> >::const_iterator p = delayed.begin();
+        p != delayed.end(); ++p)
+    {
+        p->first->ice_response(p->second);
+        values.push_back(p->second);
+    }
+    return values;
+}
+
+void
+TestI::closeConnection(Ice::Int count, const Ice::Current& current)
+{
+    //
+    // The connection is closed once the delayed replies and the reply
+    // of this request are sent.
+    //
+    current.con->close(false);
+    releaseDelayed(count, false, current);
+}
+
+void
+TestI::shutdown(const Ice::Current& current)
+{
+    current.adapter->getCommunicator()->shutdown();
+}
@@ -0,0 +1,31 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef TEST_I_H
+#define TEST_I_H
+
+#include <Test.h>
+
+class TestI : public Test::TestIntf, private IceUtil::Monitor<IceUtil::Mutex>
+{
+public:
+
+    virtual Ice::Int op(Ice::Int, const Ice::Current&);
+    virtual void opDelayed_async(const Test::AMD_TestIntf_opDelayedPtr&, Ice::Int, const Ice::Current&);
+    virtual Ice::ByteSeq echo(const Ice::ByteSeq&, const Ice::Current&);
+    virtual Ice::IntSeq releaseDelayed(Ice::Int, bool, const Ice::Current&);
+    virtual void closeConnection(Ice::Int, const Ice::Current&);
+    virtual void shutdown(const Ice::Current&);
+
+private:
+
+    std::vector<std::pair<Test::AMD_TestIntf_opDelayedPtr, Ice::Int> > _delayed;
+};
+
+#endif
@@ -162,5 +162,22 @@ allTests(const Ice::CommunicatorPtr& communicator)
     }
     cout << "ok" << endl;
 
+    cout << "testing inline dispatch... " << flush;
+    {
+        p->opInline();
+        p->ice_oneway()->opInline();
+        p->op();
+        p->ice_oneway()->op();
+        p->opInline();
+    }
+    cout << "ok" << endl;
+
+    if(p->ice_getConnection())
+    {
+        cout << "testing request over a connection without object adapter... " << flush;
+        p->pingBack();
+        cout << "ok" << endl;
+    }
+
     p->shutdown();
 }
@@ -20,6 +20,7 @@ int
 run(int, char**, const Ice::CommunicatorPtr& communicator)
 {
     communicator->getProperties()->setProperty("TestAdapter.Endpoints", "default -p 12010");
+    communicator->getProperties()->setProperty("TestAdapter.InlineDispatch", "opInline");
     communicator->getProperties()->setProperty("ControllerAdapter.Endpoints", "tcp -p 12011");
     communicator->getProperties()->setProperty("ControllerAdapter.ThreadPool.Size", "1");
 
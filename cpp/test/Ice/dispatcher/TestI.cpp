@@ -21,6 +21,12 @@ TestIntfI::op(const Ice::Current&)
     test(Dispatcher::isDispatcherThread());
 }
 
+void
+TestIntfI::opInline(const Ice::Current&)
+{
+    test(!Dispatcher::isDispatcherThread());
+}
+
 void
 TestIntfI::sleep(Ice::Int to, const Ice::Current&)
 {
@@ -33,6 +39,23 @@ TestIntfI::opWithPayload(const Ice::ByteSeq&, const Ice::Current&)
     test(Dispatcher::isDispatcherThread());
 }
 
+void
+TestIntfI::pingBack(const Ice::Current& current)
+{
+    //
+    // The client connection has no object adapter, the request must
+    // still be dispatched with the client's dispatcher installed.
+    //
+    try
+    {
+        current.con->createProxy(current.adapter->getCommunicator()->stringToIdentity("test"))->ice_ping();
+        test(false);
+    }
+    catch(const Ice::ObjectNotExistException&)
+    {
+    }
+}
+
 void
 TestIntfI::shutdown(const Ice::Current& current)
 {
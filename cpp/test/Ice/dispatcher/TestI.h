@@ -20,8 +20,10 @@ class TestIntfI : virtual public Test::TestIntf
 public:
 
     virtual void op(const Ice::Current&);
+    virtual void opInline(const Ice::Current&);
     virtual void sleep(Ice::Int, const Ice::Current&);
     virtual void opWithPayload(const Ice::ByteSeq&, const Ice::Current&);
+    virtual void pingBack(const Ice::Current&);
     virtual void shutdown(const Ice::Current&);
 };
 
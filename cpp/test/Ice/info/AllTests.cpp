@@ -237,6 +237,60 @@ allTests(const Ice::CommunicatorPtr& communicator)
     }
     cout << "ok" << endl;
 
+    cout << "testing WebSocket permessage-deflate... " << flush;
+    {
+        //
+        // The server enables permessage-deflate and compresses all the
+        // messages. The extension is only used if the client enables it.
+        //
+        TestIntfPrx intf = TestIntfPrx::uncheckedCast(communicator->stringToProxy("test:ws -p 12011"));
+        Ice::WSConnectionInfoPtr info = Ice::WSConnectionInfoPtr::dynamicCast(intf->ice_getConnection()->getInfo());
+        test(info->headers.find("Sec-WebSocket-Extensions") == info->headers.end());
+        Ice::Context ctx = intf->getConnectionInfoAsContext();
+        test(ctx.find("ws.Sec-WebSocket-Extensions") == ctx.end());
+
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.WS.PerMessageDeflate", "1");
+        initData.properties->setProperty("Ice.WS.PerMessageDeflate.Threshold", "0");
+        Ice::CommunicatorPtr comm = Ice::initialize(initData);
+        intf = TestIntfPrx::uncheckedCast(comm->stringToProxy("test:ws -p 12011"));
+        info = Ice::WSConnectionInfoPtr::dynamicCast(intf->ice_getConnection()->getInfo());
+#ifndef ICE_HAS_ZLIB
+        //
+        // Without zlib, the extension is never offered or accepted.
+        //
+        test(info->headers.find("Sec-WebSocket-Extensions") == info->headers.end());
+        ctx = intf->getConnectionInfoAsContext();
+        test(ctx.find("ws.Sec-WebSocket-Extensions") == ctx.end());
+        comm->destroy();
+#else
+        test(info->headers["Sec-WebSocket-Extensions"] == "permessage-deflate");
+        for(int i = 0; i < 10; ++i)
+        {
+            ctx = intf->getConnectionInfoAsContext();
+            test(ctx["ws.Sec-WebSocket-Extensions"] == "permessage-deflate");
+            test(ctx["ws.Sec-WebSocket-Protocol"] == "ice.zeroc.com");
+        }
+        comm->destroy();
+
+        initData.properties->setProperty("Ice.WS.PerMessageDeflate.NoContextTakeover", "1");
+        comm = Ice::initialize(initData);
+        intf = TestIntfPrx::uncheckedCast(comm->stringToProxy("test:ws -p 12011"));
+        info = Ice::WSConnectionInfoPtr::dynamicCast(intf->ice_getConnection()->getInfo());
+        test(info->headers["Sec-WebSocket-Extensions"] ==
+             "permessage-deflate; server_no_context_takeover; client_no_context_takeover");
+        for(int i = 0; i < 10; ++i)
+        {
+            ctx = intf->getConnectionInfoAsContext();
+            test(ctx["ws.Sec-WebSocket-Extensions"] ==
+                 "permessage-deflate; client_no_context_takeover; server_no_context_takeover");
+        }
+        comm->destroy();
+#endif
+    }
+    cout << "ok" << endl;
+
     testIntf->shutdown();
 
     communicator->shutdown();
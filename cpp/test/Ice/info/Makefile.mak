@@ -40,7 +40,7 @@ OBJS		= $(COBJS) \
 
 !include $(top_srcdir)/config/Make.rules.mak
 
-CPPFLAGS	= -I. -I../../include $(CPPFLAGS) -DWIN32_LEAN_AND_MEAN
+CPPFLAGS	= -I. -I../../include $(CPPFLAGS) $(ZLIB_FLAGS) -DWIN32_LEAN_AND_MEAN
 
 !if "$(WINRT)" != "yes"
 LD_TESTFLAGS	= $(LD_EXEFLAGS) $(SETARGV)
@@ -18,7 +18,7 @@ using namespace std;
 int
 run(int, char**, const Ice::CommunicatorPtr& communicator)
 {
-    communicator->getProperties()->setProperty("TestAdapter.Endpoints", "default -p 12010:udp -p 12010");
+    communicator->getProperties()->setProperty("TestAdapter.Endpoints", "default -p 12010:udp -p 12010:ws -p 12011");
     Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapter("TestAdapter");
     adapter->add(new TestI, communicator->stringToIdentity("test"));
     adapter->activate();
@@ -37,6 +37,8 @@ main(int argc, char* argv[])
     {
         Ice::InitializationData initData;
         initData.properties = Ice::createProperties(argc, argv);
+        initData.properties->setProperty("Ice.WS.PerMessageDeflate", "1");
+        initData.properties->setProperty("Ice.WS.PerMessageDeflate.Threshold", "0");
         communicator = Ice::initialize(argc, argv, initData);
         status = run(argc, argv, communicator);
     }
@@ -3,7 +3,8 @@ Test.h: \
     Test.ice \
     "$(slicedir)/Ice/Locator.ice" \
     "$(slicedir)/Ice/Identity.ice" \
-    "$(slicedir)/Ice/ProcessF.ice"
+    "$(slicedir)/Ice/ProcessF.ice" \
+    "$(slicedir)/Ice/BuiltinSequences.ice"
 
 Test.obj: \
 	Test.cpp \
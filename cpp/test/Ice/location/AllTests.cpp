@@ -560,6 +560,69 @@ allTests(const Ice::CommunicatorPtr& communicator, const string& ref)
     }
     cout << "ok" << endl;
 
+    cout << "testing batched locator requests... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.BatchLocatorRequests", "1");
+        Ice::CommunicatorPtr ic = Ice::initialize(initData);
+
+        const int nAdapters = 20;
+        Ice::ObjectPrx adapter = locator->findAdapterById("TestAdapter");
+        for(int i = 0; i < nAdapters; ++i)
+        {
+            ostringstream os;
+            os << "BatchAdapter" << i;
+            registry->setAdapterDirectProxy(os.str(), adapter);
+        }
+
+        //
+        // The first request is sent by itself, the requests sent while
+        // it's pending are queued and sent with a single batch.
+        //
+        int count = locator->getRequestCount();
+        int batchCount = locator->getBatchRequestCount();
+        list<Ice::AsyncResultPtr> results;
+        for(int i = 0; i < nAdapters; ++i)
+        {
+            ostringstream os;
+            os << "test@BatchAdapter" << i;
+            results.push_back(ic->stringToProxy(os.str())->begin_ice_ping());
+        }
+        for(list<Ice::AsyncResultPtr>::const_iterator p = results.begin(); p != results.end(); ++p)
+        {
+            (*p)->getProxy()->end_ice_ping(*p);
+        }
+        test(locator->getBatchRequestCount() > batchCount);
+        test(locator->getBatchRequestCount() < batchCount + nAdapters);
+        test(locator->getRequestCount() - count == locator->getBatchRequestCount() - batchCount);
+
+        //
+        // Unknown adapters are resolved again with findAdapterById.
+        //
+        count = locator->getRequestCount();
+        batchCount = locator->getBatchRequestCount();
+        try
+        {
+            ic->stringToProxy("test@UnknownBatchAdapter")->ice_ping();
+            test(false);
+        }
+        catch(const Ice::NotRegisteredException&)
+        {
+        }
+        test(locator->getBatchRequestCount() > batchCount);
+        test(locator->getRequestCount() - count > locator->getBatchRequestCount() - batchCount);
+
+        for(int i = 0; i < nAdapters; ++i)
+        {
+            ostringstream os;
+            os << "BatchAdapter" << i;
+            registry->setAdapterDirectProxy(os.str(), 0);
+        }
+        ic->destroy();
+    }
+    cout << "ok" << endl;
+
     cout << "testing proxy from server after shutdown... " << flush;
     hello = obj->getReplicatedHello();
     obj->shutdown();
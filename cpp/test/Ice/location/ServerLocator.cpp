@@ -98,7 +98,8 @@ ServerLocatorRegistry::addObject(const Ice::ObjectPrx& object)
 ServerLocator::ServerLocator(const ServerLocatorRegistryPtr& registry, const ::Ice::LocatorRegistryPrx& registryPrx) :
     _registry(registry),
     _registryPrx(registryPrx),
-    _requestCount(0)
+    _requestCount(0),
+    _batchRequestCount(0)
 {
 }
 
@@ -142,3 +143,33 @@ ServerLocator::getRequestCount(const ::Ice::Current&) const
 {
     return _requestCount;
 }
+
+void
+ServerLocator::findAdaptersById_async(const Test::AMD_TestLocator_findAdaptersByIdPtr& response,
+                                      const Ice::StringSeq& ids, const Ice::Current&) const
+{
+    ++const_cast<int&>(_requestCount);
+    ++const_cast<int&>(_batchRequestCount);
+
+    // Add a small delay so that concurrent requests are batched.
+    IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(10));
+    Ice::ObjectProxySeq proxies;
+    for(Ice::StringSeq::const_iterator p = ids.begin(); p != ids.end(); ++p)
+    {
+        try
+        {
+            proxies.push_back(_registry->getAdapter(*p));
+        }
+        catch(const Ice::AdapterNotFoundException&)
+        {
+            proxies.push_back(0);
+        }
+    }
+    response->ice_response(proxies);
+}
+
+int
+ServerLocator::getBatchRequestCount(const ::Ice::Current&) const
+{
+    return _batchRequestCount;
+}
@@ -60,11 +60,17 @@ public:
 
     virtual int getRequestCount(const Ice::Current&) const;
 
+    virtual void findAdaptersById_async(const Test::AMD_TestLocator_findAdaptersByIdPtr&, const Ice::StringSeq&,
+                                        const Ice::Current&) const;
+
+    virtual int getBatchRequestCount(const Ice::Current&) const;
+
 private:
     
     ServerLocatorRegistryPtr _registry;
     ::Ice::LocatorRegistryPrx _registryPrx;
     int _requestCount;
+    int _batchRequestCount;
 };
 
 #endif
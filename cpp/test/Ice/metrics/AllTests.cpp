@@ -8,6 +8,8 @@
 // **********************************************************************
 
 #include <Ice/Ice.h>
+#include <Ice/Network.h>
+#include <Ice/MetricsObserverI.h>
 #include <TestCommon.h>
 #include <InstrumentationI.h>
 #include <Test.h>
@@ -371,6 +373,39 @@ checkFailure(const IceMX::MetricsAdminPrx& m, const string& map, const string& i
     }
 }
 
+void
+invokeConcurrently(const Test::MetricsPrx& metrics)
+{
+    vector<Ice::AsyncResultPtr> results;
+    for(int i = 0; i < 20; ++i)
+    {
+        results.push_back(metrics->begin_op());
+    }
+    for(vector<Ice::AsyncResultPtr>::const_iterator p = results.begin(); p != results.end(); ++p)
+    {
+        metrics->end_op(*p);
+    }
+    for(int i = 0; i < 5; ++i)
+    {
+        try
+        {
+            metrics->opWithUserException();
+            test(false);
+        }
+        catch(const Test::UserEx&)
+        {
+        }
+    }
+    try
+    {
+        metrics->opWithLocalException();
+        test(false);
+    }
+    catch(const Ice::LocalException&)
+    {
+    }
+}
+
 map<string, IceMX::MetricsPtr>
 toMap(const IceMX::MetricsMap& mmap)
 {
@@ -382,6 +417,218 @@ toMap(const IceMX::MetricsMap& mmap)
     return m;
 }
 
+//
+// Sends a plain HTTP GET request to the admin WebSocket endpoint and
+// returns the response, the server closes the connection once the
+// response is sent.
+//
+string
+httpGet(const string& resource)
+{
+    IceInternal::Address addr =
+        IceInternal::getAddressForServer("127.0.0.1", 12012, IceInternal::EnableIPv4, false);
+    SOCKET fd = IceInternal::createSocket(false, addr);
+    IceInternal::setBlock(fd, true);
+    IceInternal::doConnect(fd, addr, IceInternal::Address());
+
+    const string request = "GET " + resource + " HTTP/1.1\r\nHost: 127.0.0.1:12012\r\n\r\n";
+    test(::send(fd, request.c_str(), static_cast<int>(request.size()), 0) == static_cast<int>(request.size()));
+
+    string response;
+    char buf[1024];
+    while(true)
+    {
+        int n = static_cast<int>(::recv(fd, buf, sizeof(buf), 0));
+        if(n <= 0)
+        {
+            break;
+        }
+        response.append(buf, n);
+    }
+    IceInternal::closeSocket(fd);
+    return response;
+}
+
+//
+// Metrics type without mergeMetrics overload, its maps can't be sharded.
+//
+class GaugeMetrics : public IceMX::ThreadMetrics
+{
+public:
+
+    virtual Ice::ObjectPtr
+    ice_clone() const
+    {
+        return new GaugeMetrics(*this);
+    }
+};
+
+template<typename T> class GaugeHelperT : public IceMX::MetricsHelperT<T>
+{
+public:
+
+    virtual string operator()(const string& attribute) const
+    {
+        return attribute == "id" ? "gauge" : "";
+    }
+};
+
+struct GaugeIncrement
+{
+    template<typename T> void operator()(const IceInternal::Handle<T>& v)
+    {
+        ++v->inUseForUser;
+    }
+};
+
+//
+// Decrements the gauge with a lower bound like the IceStorm and Glacier2
+// queue gauges.
+//
+struct GaugeDecrement
+{
+    template<typename T> void operator()(const IceInternal::Handle<T>& v)
+    {
+        if(v->inUseForUser > 0)
+        {
+            --v->inUseForUser;
+        }
+        ++v->inUseForOther;
+    }
+};
+
+struct CounterIncrement
+{
+    template<typename T> void operator()(const IceInternal::Handle<T>& v)
+    {
+        ++v->inUseForIO;
+    }
+};
+
+template<typename T> class GaugeThread : public IceUtil::Thread
+{
+public:
+
+    GaugeThread(const IceUtil::Handle<IceMX::ObserverT<T> >& observer, bool increment, bool unsharded) :
+        _observer(observer), _increment(increment), _unsharded(unsharded)
+    {
+    }
+
+    virtual void
+    run()
+    {
+        for(int i = 0; i < 100; ++i)
+        {
+            if(_increment && _unsharded)
+            {
+                _observer->forEachUnsharded(GaugeIncrement());
+            }
+            else if(_increment)
+            {
+                _observer->forEach(GaugeIncrement());
+            }
+            else if(_unsharded)
+            {
+                _observer->forEachUnsharded(GaugeDecrement());
+            }
+            else
+            {
+                _observer->forEach(GaugeDecrement());
+            }
+            _observer->forEach(CounterIncrement());
+        }
+    }
+
+private:
+
+    const IceUtil::Handle<IceMX::ObserverT<T> > _observer;
+    const bool _increment;
+    const bool _unsharded;
+};
+
+//
+// Increments the gauge of a sharded map from a thread and decrements it
+// from another thread, each thread updates its own shard.
+//
+template<typename T> IceMX::ThreadMetricsPtr
+testGauge(const Ice::CommunicatorPtr& communicator, bool unsharded)
+{
+    Ice::PropertiesPtr properties = Ice::createProperties();
+    properties->setProperty("IceMX.Metrics.View.Map.Gauge.Shards", "4");
+    IceInternal::MetricsAdminIPtr admin = new IceInternal::MetricsAdminI(properties, communicator->getLogger());
+    IceUtil::Handle<IceMX::ObserverFactoryT<IceMX::ObserverT<T> > > factory =
+        new IceMX::ObserverFactoryT<IceMX::ObserverT<T> >(admin, "Gauge");
+
+    IceUtil::Handle<IceMX::ObserverT<T> > observer = factory->getObserver(GaugeHelperT<T>());
+    test(observer);
+    observer->attach();
+
+    IceUtil::ThreadPtr thread = new GaugeThread<T>(observer, true, unsharded);
+    thread->start().join();
+    thread = new GaugeThread<T>(observer, false, unsharded);
+    thread->start().join();
+
+    Ice::Long timestamp;
+    IceMX::MetricsView view = admin->getMetricsView("View", timestamp, Ice::Current());
+    observer->detach();
+    factory->destroy();
+    admin->destroy();
+
+    test(view["Gauge"].size() == 1);
+    return IceMX::ThreadMetricsPtr::dynamicCast(view["Gauge"][0]);
+}
+
+class WarningLoggerI : public Ice::Logger, private IceUtil::Mutex
+{
+public:
+
+    virtual void
+    print(const string&)
+    {
+    }
+
+    virtual void
+    trace(const string&, const string&)
+    {
+    }
+
+    virtual void
+    warning(const string& message)
+    {
+        Lock sync(*this);
+        _warnings.push_back(message);
+    }
+
+    virtual void
+    error(const string&)
+    {
+    }
+
+    virtual string
+    getPrefix()
+    {
+        return "";
+    }
+
+    virtual Ice::LoggerPtr
+    cloneWithPrefix(const string&)
+    {
+        return this;
+    }
+
+    vector<string>
+    getWarnings()
+    {
+        Lock sync(*this);
+        return _warnings;
+    }
+
+private:
+
+    vector<string> _warnings;
+};
+typedef IceUtil::Handle<WarningLoggerI> WarningLoggerIPtr;
+
 }
 
 MetricsPrx
@@ -1130,6 +1377,158 @@ allTests(const Ice::CommunicatorPtr& communicator, const CommunicatorObserverIPt
 
     cout << "ok" << endl;
 
+    cout << "testing lifetime histograms... " << flush;
+
+    props.clear();
+    props["IceMX.Metrics.View.Map.Dispatch.GroupBy"] = "operation";
+    updateProps(clientProps, serverProps, update, props, "Dispatch");
+    metrics->op();
+    map = toMap(serverMetrics->getMetricsView("View", timestamp)["Dispatch"]);
+    test(map["op"] && !map["op"]->lifetimeHistogram && !map["op"]->lifetimeQuantiles);
+
+    props["IceMX.Metrics.View.Map.Dispatch.Histogram"] = "1";
+    updateProps(clientProps, serverProps, update, props, "Dispatch");
+    metrics->op();
+    metrics->op();
+    waitForCurrent(serverMetrics, "View", "Dispatch", 0);
+    map = toMap(serverMetrics->getMetricsView("View", timestamp)["Dispatch"]);
+    test(map["op"]->total == 2 && map["op"]->lifetimeHistogram && map["op"]->lifetimeQuantiles);
+
+    props["IceMX.Metrics.View.Map.Invocation.GroupBy"] = "operation";
+    props["IceMX.Metrics.View.Map.Invocation.Histogram"] = "1";
+    props["IceMX.Metrics.View.Map.Invocation.Map.Remote.Histogram"] = "1";
+    props["IceMX.Metrics.View.Map.Invocation.Map.Collocated.Histogram"] = "1";
+    updateProps(clientProps, serverProps, update, props, "Invocation");
+    for(int i = 0; i < 10; ++i)
+    {
+        metrics->op();
+    }
+    waitForCurrent(clientMetrics, "View", "Invocation", 0);
+
+    map = toMap(clientMetrics->getMetricsView("View", timestamp)["Invocation"]);
+    im1 = IceMX::InvocationMetricsPtr::dynamicCast(map["op"]);
+    test(im1->total == 10 && im1->lifetimeHistogram && im1->lifetimeQuantiles);
+    Ice::Long count = 0;
+    for(Ice::LongSeq::const_iterator p = im1->lifetimeHistogram->begin(); p != im1->lifetimeHistogram->end(); ++p)
+    {
+        count += *p;
+    }
+    test(count == 10 && im1->lifetimeHistogram->back() > 0);
+    IceMX::StringLongDict quantiles = *im1->lifetimeQuantiles;
+    test(quantiles.size() == 4);
+    test(quantiles["p50"] <= quantiles["p90"] && quantiles["p90"] <= quantiles["p99"] &&
+         quantiles["p99"] <= quantiles["p999"]);
+    test(quantiles["p999"] * 10 >= im1->totalLifetime);
+
+    rim1 = IceMX::ChildInvocationMetricsPtr::dynamicCast(!collocated ? im1->remotes[0] : im1->collocated[0]);
+    test(rim1->total == 10 && rim1->lifetimeHistogram && rim1->lifetimeQuantiles);
+
+    cout << "ok" << endl;
+
+    cout << "testing sharded metrics... " << flush;
+
+    props.clear();
+    props["IceMX.Metrics.View.Map.Dispatch.GroupBy"] = "operation";
+    props["IceMX.Metrics.View.Map.Dispatch.Shards"] = "4";
+    props["IceMX.Metrics.View.Map.Dispatch.Histogram"] = "1";
+    updateProps(clientProps, serverProps, update, props, "Dispatch");
+    invokeConcurrently(metrics);
+
+    waitForCurrent(serverMetrics, "View", "Dispatch", 0);
+    map = toMap(serverMetrics->getMetricsView("View", timestamp)["Dispatch"]);
+    test(map.size() == 3);
+    dm1 = IceMX::DispatchMetricsPtr::dynamicCast(map["op"]);
+    test(dm1->current == 0 && dm1->total == 20 && dm1->failures == 0 && dm1->userException == 0);
+    test(dm1->size == 20 * 21 && dm1->replySize == 20 * 7);
+    Ice::Long lifetimes = 0;
+    for(Ice::LongSeq::const_iterator p = dm1->lifetimeHistogram->begin(); p != dm1->lifetimeHistogram->end(); ++p)
+    {
+        lifetimes += *p;
+    }
+    test(lifetimes == 20);
+    dm1 = IceMX::DispatchMetricsPtr::dynamicCast(map["opWithUserException"]);
+    test(dm1->current == 0 && dm1->total == 5 && dm1->failures == 0 && dm1->userException == 5);
+    test(dm1->size == 5 * 38 && dm1->replySize == 5 * 23);
+    dm1 = IceMX::DispatchMetricsPtr::dynamicCast(map["opWithLocalException"]);
+    test(dm1->current == 0 && dm1->total == 1 && dm1->failures == 1);
+    checkFailure(serverMetrics, "Dispatch", dm1->id, "Ice::SyscallException", 1);
+
+    props["IceMX.Metrics.View.Map.Invocation.GroupBy"] = "operation";
+    props["IceMX.Metrics.View.Map.Invocation.Shards"] = "4";
+    props["IceMX.Metrics.View.Map.Invocation.Map.Remote.GroupBy"] = "localPort";
+    props["IceMX.Metrics.View.Map.Invocation.Map.Remote.Shards"] = "4";
+    props["IceMX.Metrics.View.Map.Invocation.Map.Collocated.GroupBy"] = "parent";
+    props["IceMX.Metrics.View.Map.Invocation.Map.Collocated.Shards"] = "4";
+    updateProps(clientProps, serverProps, update, props, "Invocation");
+    invokeConcurrently(metrics);
+
+    waitForCurrent(clientMetrics, "View", "Invocation", 0);
+    map = toMap(clientMetrics->getMetricsView("View", timestamp)["Invocation"]);
+    test(map.size() == 3);
+    im1 = IceMX::InvocationMetricsPtr::dynamicCast(map["op"]);
+    test(im1->current == 0 && im1->total == 20 && im1->failures == 0 && im1->retry == 0);
+    im1 = IceMX::InvocationMetricsPtr::dynamicCast(map["opWithUserException"]);
+    test(im1->current == 0 && im1->total == 5 && im1->failures == 0 && im1->userException == 5);
+    test(!collocated ? (im1->remotes.size() == 1) : (im1->collocated.size() == 1));
+    rim1 = IceMX::ChildInvocationMetricsPtr::dynamicCast(!collocated ? im1->remotes[0] : im1->collocated[0]);
+    test(rim1->current == 0 && rim1->total == 5 && rim1->size == 5 * 38 && rim1->replySize == 5 * 23);
+
+    cout << "ok" << endl;
+
+    cout << "testing sharded gauges... " << flush;
+
+    IceMX::ThreadMetricsPtr tm = testGauge<IceMX::ThreadMetrics>(communicator, true);
+    test(tm->inUseForUser == 0 && tm->inUseForOther == 100 && tm->inUseForIO == 200);
+
+    //
+    // Sharding is disabled for the maps of a metrics type which doesn't
+    // provide a mergeMetrics overload, all the updates are applied to the
+    // same metrics object.
+    //
+    Ice::LoggerPtr processLogger = Ice::getProcessLogger();
+    WarningLoggerIPtr logger = new WarningLoggerI();
+    Ice::setProcessLogger(logger);
+    tm = testGauge<GaugeMetrics>(communicator, false);
+    Ice::setProcessLogger(processLogger);
+    test(tm->inUseForUser == 0 && tm->inUseForOther == 100 && tm->inUseForIO == 200);
+    test(logger->getWarnings().size() == 1);
+    test(logger->getWarnings()[0].find("IceMX.Metrics.View.Map.Gauge.Shards") != string::npos);
+
+    cout << "ok" << endl;
+
+    cout << "testing OpenMetrics HTTP endpoint... " << flush;
+
+    string response = httpGet("/metrics");
+    test(response.find("HTTP/1.1 200 OK\r\n") == 0);
+    test(response.find("Content-Type: application/openmetrics-text;") != string::npos);
+    string body = response.substr(response.find("\r\n\r\n") + 4);
+    test(body.size() > 6 && body.substr(body.size() - 6) == "# EOF\n");
+    test(body.find("# TYPE ice_invocation counter\n") != string::npos);
+    test(body.find("ice_invocation_total{view=\"View\",id=\"op\"} 20\n") != string::npos);
+    test(body.find("ice_invocation_current{view=\"View\",id=\"op\"} 0\n") != string::npos);
+    test(body.find("ice_invocation_user_exceptions_total{view=\"View\",id=\"opWithUserException\"} 5\n") !=
+         string::npos);
+    test(body.find(string(!collocated ? "ice_invocation_remote" : "ice_invocation_collocated") +
+                   "_total{view=\"View\",invocation=\"opWithUserException\",id=") != string::npos);
+
+    props.clear();
+    props["IceMX.Metrics.View.Map.Invocation.GroupBy"] = "operation";
+    props["IceMX.Metrics.View.Map.Invocation.Histogram"] = "1";
+    updateProps(clientProps, serverProps, update, props, "Invocation");
+    metrics->op();
+    metrics->op();
+    waitForCurrent(clientMetrics, "View", "Invocation", 0);
+    body = httpGet("/metrics?view=View");
+    test(body.find("# TYPE ice_invocation_lifetime_distribution_microseconds histogram\n") != string::npos);
+    test(body.find("ice_invocation_lifetime_distribution_microseconds_bucket{view=\"View\",id=\"op\",le=\"+Inf\"} 2\n")
+         != string::npos);
+    test(body.find("ice_invocation_lifetime_distribution_microseconds_count{view=\"View\",id=\"op\"} 2\n") !=
+         string::npos);
+
+    test(httpGet("/unknown").find("HTTP/1.1 404 Not Found\r\n") == 0);
+
+    cout << "ok" << endl;
+
     cout << "testing metrics view enable/disable..." << flush;
 
     Ice::StringSeq disabledViews;
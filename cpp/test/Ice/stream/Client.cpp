@@ -8,6 +8,7 @@
 // **********************************************************************
 
 #include <Ice/Ice.h>
+#include <Ice/BasicStream.h>
 #include <TestCommon.h>
 #include <Test.h>
 
@@ -148,6 +149,38 @@ public:
     }
 };
 
+//
+// Marshals the sequence with the stream API, which marshals each struct
+// member by member, and with the stream used for requests, which copies
+// sequences of bulk copyable structs at once. Both must produce the same
+// bytes and unmarshal to the same sequence.
+//
+template<typename T> void
+testFixedSeq(const Ice::CommunicatorPtr& communicator, const vector<T>& seq)
+{
+    Ice::OutputStreamPtr out = Ice::createOutputStream(communicator);
+    out->write(seq);
+    vector<Ice::Byte> data;
+    out->finished(data);
+
+    IceInternal::InstancePtr instance = IceInternal::getInstance(communicator);
+    IceInternal::BasicStream os(instance.get(), Ice::currentEncoding);
+    const T* begin = seq.empty() ? 0 : &seq[0];
+    os.write(begin, begin + seq.size());
+    test(vector<Ice::Byte>(os.b.begin(), os.b.end()) == data);
+
+    IceInternal::BasicStream is(instance.get(), Ice::currentEncoding, &data[0], &data[0] + data.size());
+    vector<T> seq2;
+    is.read(seq2);
+    test(seq2 == seq);
+    test(is.i == is.b.end());
+
+    Ice::InputStreamPtr in = Ice::createInputStream(communicator, vector<Ice::Byte>(os.b.begin(), os.b.end()));
+    vector<T> seq3;
+    in->read(seq3);
+    test(seq3 == seq);
+}
+
 int
 run(int, char**, const Ice::CommunicatorPtr& communicator)
 {
@@ -796,6 +829,87 @@ run(int, char**, const Ice::CommunicatorPtr& communicator)
         test(arr2S[2].size() == arrS[2].size());
     }
 
+    {
+        //
+        // A class graph with many instances, forward and backward
+        // references and a cycle. The decoder looks up instances that
+        // were already un-marshaled by index, test this with both
+        // encodings since they don't allocate indexes from the same
+        // base.
+        //
+        Ice::EncodingVersion encodings[] = { Ice::Encoding_1_0, Ice::Encoding_1_1 };
+        for(size_t e = 0; e < sizeof(encodings) / sizeof(*encodings); ++e)
+        {
+            const int size = 200;
+            Test::MyClassS nodes;
+            for(int i = 0; i < size; ++i)
+            {
+                Test::MyClassPtr c = new Test::MyClass;
+                c->s.e = Test::enum1;
+                c->seq4.push_back(i);
+                nodes.push_back(c);
+            }
+            for(int i = 0; i < size; ++i)
+            {
+                nodes[i]->c = nodes[(i + 1) % size];
+                nodes[i]->o = nodes[0];
+                if(i > 0)
+                {
+                    nodes[i]->d["prev"] = nodes[i - 1];
+                }
+                nodes[i]->seq10.push_back(nodes[i]);
+                nodes[i]->seq10.push_back(nodes[size - 1 - i]);
+            }
+
+            out = Ice::createOutputStream(communicator, encodings[e]);
+            out->write(nodes[0]);
+            out->write(nodes[size / 2]);
+            out->writePendingObjects();
+            out->finished(data);
+            in = Ice::createInputStream(communicator, data, encodings[e]);
+            Test::MyClassPtr root;
+            Test::MyClassPtr middle;
+            in->read(root);
+            in->read(middle);
+            in->readPendingObjects();
+
+            Test::MyClassS nodes2;
+            Test::MyClassPtr c = root;
+            for(int i = 0; i < size; ++i)
+            {
+                test(c);
+                test(c->seq4.size() == 1 && c->seq4[0] == i);
+                nodes2.push_back(c);
+                c = c->c;
+            }
+            test(c == root);
+            test(middle == nodes2[size / 2]);
+            for(int i = 0; i < size; ++i)
+            {
+                test(nodes2[i]->o == root);
+                test(i == 0 ? nodes2[i]->d.empty() : nodes2[i]->d["prev"] == nodes2[i - 1]);
+                test(nodes2[i]->seq10.size() == 2);
+                test(nodes2[i]->seq10[0] == nodes2[i]);
+                test(nodes2[i]->seq10[1] == nodes2[size - 1 - i]);
+            }
+
+            //
+            // Break the cycles.
+            //
+            for(int i = 0; i < size; ++i)
+            {
+                nodes[i]->c = 0;
+                nodes[i]->o = 0;
+                nodes[i]->d.clear();
+                nodes[i]->seq10.clear();
+                nodes2[i]->c = 0;
+                nodes2[i]->o = 0;
+                nodes2[i]->d.clear();
+                nodes2[i]->seq10.clear();
+            }
+        }
+    }
+
     {
         Test::MyInterfacePtr i = new Test::MyInterface();
         out = Ice::createOutputStream(communicator);
@@ -1118,6 +1232,41 @@ run(int, char**, const Ice::CommunicatorPtr& communicator)
     }
 
     cout << "ok" << endl;
+
+    cout << "testing sequences of fixed-size structs... " << flush;
+
+    {
+        test(Ice::StreamBulkCopyable<Test::PackedStruct>::value);
+        test(static_cast<int>(sizeof(Test::PackedStruct)) == Ice::StreamableTraits<Test::PackedStruct>::minWireSize);
+        test(!Ice::StreamBulkCopyable<Test::PaddedStruct>::value);
+        test(static_cast<int>(sizeof(Test::PaddedStruct)) != Ice::StreamableTraits<Test::PaddedStruct>::minWireSize);
+
+        Test::PackedStructS packed;
+        Test::PaddedStructS padded;
+        testFixedSeq(communicator, packed);
+        testFixedSeq(communicator, padded);
+
+        for(int i = 0; i < 100; ++i)
+        {
+            Test::PackedStruct p;
+            p.i = i * 65537 - 1000;
+            p.s1 = static_cast<Ice::Short>(-i);
+            p.s2 = static_cast<Ice::Short>(i * 257);
+            p.d = i * 1.5;
+            packed.push_back(p);
+
+            Test::PaddedStruct q;
+            q.b = static_cast<Ice::Byte>(i);
+            q.i = -i * 65537;
+            q.s = static_cast<Ice::Short>(i * 3);
+            padded.push_back(q);
+        }
+        testFixedSeq(communicator, packed);
+        testFixedSeq(communicator, padded);
+    }
+
+    cout << "ok" << endl;
+
     return 0;
 }
 
@@ -8,6 +8,7 @@
 // **********************************************************************
 
 #include <Ice/Ice.h>
+#include <IceUtil/Random.h>
 #include <TestCommon.h>
 #include <Test.h>
 #include <TestI.h>
@@ -80,6 +81,19 @@ public:
 };
 typedef IceUtil::Handle<Callback> CallbackPtr;
 
+//
+// Returns a payload filled with random data, it must not shrink if the
+// messages are compressed by the transport (WebSocket permessage-deflate)
+// for the requests to fill the socket buffers.
+//
+ByteSeq
+createPayload(size_t size)
+{
+    ByteSeq seq(size);
+    IceUtilInternal::generateRandom(reinterpret_cast<char*>(&seq[0]), seq.size());
+    return seq;
+}
+
 TimeoutPrx
 allTests(const Ice::CommunicatorPtr& communicator)
 {
@@ -126,7 +140,7 @@ allTests(const Ice::CommunicatorPtr& communicator)
     cout << "ok" << endl;
 
     // The sequence needs to be large enough to fill the write/recv buffers
-    ByteSeq seq(2000000);
+    ByteSeq seq = createPayload(2000000);
 
     cout << "testing connection timeout... " << flush;
     {
@@ -154,7 +168,7 @@ allTests(const Ice::CommunicatorPtr& communicator)
         timeout->holdAdapter(500);
         try
         {
-            ByteSeq seq(1000000);
+            ByteSeq seq = createPayload(1000000);
             to->sendData(seq);
         }
         catch(const Ice::TimeoutException&)
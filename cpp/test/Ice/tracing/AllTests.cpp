@@ -0,0 +1,316 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <Ice/Metrics.h>
+#include <TestCommon.h>
+#include <Test.h>
+#include <iomanip>
+#include <fstream>
+
+using namespace std;
+using namespace Test;
+
+namespace
+{
+
+//
+// Returns the spans recorded by the given tracer, the spans of the
+// getSpans invocations and dispatches are ignored. The dispatch spans
+// are recorded once the reply is sent so we retry until the expected
+// number of spans is recorded.
+//
+IceMX::SpanSeq
+getSpans(const IceMX::TracerAdminPtr& tracer, const IceMX::TracerAdminPrx& tracerPrx, size_t count)
+{
+    IceMX::SpanSeq spans;
+    for(int i = 0; i < 100; ++i)
+    {
+        Ice::Long dropped;
+        IceMX::SpanSeq s = tracer ? tracer->getSpans(dropped, Ice::Current()) : tracerPrx->getSpans(dropped);
+        test(dropped == 0);
+        for(IceMX::SpanSeq::const_iterator p = s.begin(); p != s.end(); ++p)
+        {
+            if(p->operation != "getSpans")
+            {
+                spans.push_back(*p);
+            }
+        }
+        if(spans.size() >= count)
+        {
+            break;
+        }
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(10));
+    }
+    test(spans.size() == count);
+    return spans;
+}
+
+const IceMX::Span&
+findSpan(const IceMX::SpanSeq& spans, const string& operation, bool dispatch)
+{
+    for(IceMX::SpanSeq::const_iterator p = spans.begin(); p != spans.end(); ++p)
+    {
+        if(p->operation == operation && p->dispatch == dispatch)
+        {
+            return *p;
+        }
+    }
+    test(false);
+    return spans.front();
+}
+
+void
+checkChild(const IceMX::Span& parent, const IceMX::Span& child)
+{
+    test(child.traceIdHigh == parent.traceIdHigh);
+    test(child.traceIdLow == parent.traceIdLow);
+    test(child.parentSpanId == parent.spanId);
+    test(child.spanId != parent.spanId);
+}
+
+string
+toHex(Ice::Long v)
+{
+    ostringstream os;
+    os << hex << setfill('0') << setw(8) << static_cast<unsigned int>((v >> 32) & 0xffffffff)
+       << setw(8) << static_cast<unsigned int>(v & 0xffffffff);
+    return os.str();
+}
+
+class InvokeThread : public IceUtil::Thread
+{
+public:
+
+    InvokeThread(const TestIntfPrx& test) : _test(test)
+    {
+    }
+
+    virtual void
+    run()
+    {
+        _test->op();
+    }
+
+private:
+
+    const TestIntfPrx _test;
+};
+
+}
+
+TestIntfPrx
+allTests(const Ice::CommunicatorPtr& communicator)
+{
+    TestIntfPrx test = TestIntfPrx::checkedCast(communicator->stringToProxy("test:default -p 12010"));
+    test(test);
+
+    IceMX::TracerAdminPtr clientTracer = IceMX::TracerAdminPtr::dynamicCast(communicator->findAdminFacet("Tracer"));
+    test(clientTracer);
+    IceMX::TracerAdminPrx serverTracer =
+        IceMX::TracerAdminPrx::checkedCast(communicator->stringToProxy("server/admin -f Tracer:default -p 12011"));
+    test(serverTracer);
+
+    //
+    // Drain the spans of the ice_isA invocations and dispatches above.
+    //
+    getSpans(clientTracer, 0, 2);
+    getSpans(0, serverTracer, 2);
+
+    cout << "testing invocation and dispatch spans... " << flush;
+    {
+        test->op();
+
+        IceMX::SpanSeq clientSpans = getSpans(clientTracer, 0, 1);
+        const IceMX::Span& invocation = clientSpans[0];
+        test(!invocation.dispatch);
+        test(invocation.operation == "op");
+        test(invocation.id == test->ice_getIdentity());
+        test(invocation.traceIdHigh != 0 || invocation.traceIdLow != 0);
+        test(invocation.spanId != 0);
+        test(invocation.parentSpanId == 0);
+        test(invocation.start > 0 && invocation.duration >= 0);
+        test(!invocation.userException && invocation.failure.empty());
+
+        IceMX::SpanSeq serverSpans = getSpans(0, serverTracer, 1);
+        const IceMX::Span& dispatch = serverSpans[0];
+        test(dispatch.dispatch);
+        test(dispatch.operation == "op");
+        test(dispatch.id == test->ice_getIdentity());
+        checkChild(invocation, dispatch);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing trace context... " << flush;
+    {
+        string traceParent = test->getTraceParent();
+        IceMX::SpanSeq clientSpans = getSpans(clientTracer, 0, 1);
+        const IceMX::Span& invocation = clientSpans[0];
+        test(traceParent == "00-" + toHex(invocation.traceIdHigh) + toHex(invocation.traceIdLow) + "-" +
+             toHex(invocation.spanId) + "-01");
+        getSpans(0, serverTracer, 1);
+
+        //
+        // The trace context is added to explicit contexts and proxy contexts.
+        //
+        Ice::Context ctx;
+        ctx["foo"] = "bar";
+        test(test->getTraceParent(ctx).size() == traceParent.size());
+        test(test->ice_context(ctx)->getTraceParent().size() == traceParent.size());
+        test(ctx.size() == 1);
+        getSpans(clientTracer, 0, 2);
+        getSpans(0, serverTracer, 2);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing nested spans... " << flush;
+    {
+        test->forward(test);
+
+        IceMX::SpanSeq clientSpans = getSpans(clientTracer, 0, 1);
+        IceMX::SpanSeq serverSpans = getSpans(0, serverTracer, 3);
+        const IceMX::Span& forwardInvocation = findSpan(clientSpans, "forward", false);
+        const IceMX::Span& forwardDispatch = findSpan(serverSpans, "forward", true);
+        const IceMX::Span& opInvocation = findSpan(serverSpans, "op", false);
+        const IceMX::Span& opDispatch = findSpan(serverSpans, "op", true);
+        checkChild(forwardInvocation, forwardDispatch);
+        checkChild(forwardDispatch, opInvocation);
+        checkChild(opInvocation, opDispatch);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing failures... " << flush;
+    {
+        try
+        {
+            test->throwUserException();
+            test(false);
+        }
+        catch(const TestException&)
+        {
+        }
+        IceMX::SpanSeq clientSpans = getSpans(clientTracer, 0, 1);
+        test(clientSpans[0].userException && clientSpans[0].failure.empty());
+        IceMX::SpanSeq serverSpans = getSpans(0, serverTracer, 1);
+        test(serverSpans[0].userException && serverSpans[0].failure.empty());
+
+        try
+        {
+            TestIntfPrx::uncheckedCast(test->ice_facet("missing"))->op();
+            test(false);
+        }
+        catch(const Ice::FacetNotExistException&)
+        {
+        }
+        clientSpans = getSpans(clientTracer, 0, 1);
+        test(clientSpans[0].failure == "Ice::FacetNotExistException");
+        serverSpans = getSpans(0, serverTracer, 1);
+        test(serverSpans[0].failure == "Ice::FacetNotExistException");
+        checkChild(clientSpans[0], serverSpans[0]);
+
+        try
+        {
+            communicator->stringToProxy("test:default -p 12019")->ice_ping();
+            test(false);
+        }
+        catch(const Ice::ConnectFailedException&)
+        {
+        }
+        clientSpans = getSpans(clientTracer, 0, 1);
+        test(clientSpans[0].operation == "ice_ping");
+        test(!clientSpans[0].failure.empty());
+    }
+    cout << "ok" << endl;
+
+    cout << "testing asynchronous invocations... " << flush;
+    {
+        test->end_op(test->begin_op());
+
+        IceMX::SpanSeq clientSpans = getSpans(clientTracer, 0, 1);
+        IceMX::SpanSeq serverSpans = getSpans(0, serverTracer, 1);
+        test(clientSpans[0].operation == "op" && !clientSpans[0].dispatch);
+        test(serverSpans[0].operation == "op" && serverSpans[0].dispatch);
+        checkChild(clientSpans[0], serverSpans[0]);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing spans of exited threads... " << flush;
+    {
+        //
+        // The tracer keeps the spans recorded by a thread once the thread
+        // exits.
+        //
+        for(int i = 0; i < 3; ++i)
+        {
+            IceUtil::ThreadPtr thread = new InvokeThread(test);
+            thread->start().join();
+        }
+        IceMX::SpanSeq clientSpans = getSpans(clientTracer, 0, 3);
+        for(IceMX::SpanSeq::const_iterator p = clientSpans.begin(); p != clientSpans.end(); ++p)
+        {
+            test(p->operation == "op" && !p->dispatch);
+        }
+        getSpans(0, serverTracer, 3);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing sampling... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.Tracer.SampleRate", "0");
+        Ice::CommunicatorPtr com = Ice::initialize(initData);
+        TestIntfPrx prx = TestIntfPrx::uncheckedCast(com->stringToProxy(test->ice_toString()));
+        test(prx->getTraceParent().empty());
+        prx->forward(prx);
+        Ice::Long dropped;
+        IceMX::TracerAdminPtr tracer = IceMX::TracerAdminPtr::dynamicCast(com->findAdminFacet("Tracer"));
+        test(tracer->getSpans(dropped, Ice::Current()).empty());
+        com->destroy();
+
+        //
+        // The requests above don't have a trace context and the server,
+        // which doesn't sample requests itself, didn't record them. It
+        // records the dispatch of a request sampled by the client.
+        //
+        test->op();
+        getSpans(0, serverTracer, 1);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing span export... " << flush;
+    {
+        const string file = "tracer.log";
+        remove(file.c_str());
+
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.Tracer.File", file);
+        Ice::CommunicatorPtr com = Ice::initialize(initData);
+        TestIntfPrx prx = TestIntfPrx::uncheckedCast(com->stringToProxy(test->ice_toString()));
+        prx->op();
+        com->destroy();
+        getSpans(0, serverTracer, 1);
+
+        ifstream in(file.c_str());
+        test(in);
+        string line;
+        test(getline(in, line));
+        test(line.find("\"kind\":\"invocation\"") != string::npos);
+        test(line.find("\"id\":\"test\"") != string::npos);
+        test(line.find("\"operation\":\"op\"") != string::npos);
+        test(line.find("\"parentSpanId\"") == string::npos);
+        test(!getline(in, line));
+        in.close();
+        remove(file.c_str());
+    }
+    cout << "ok" << endl;
+
+    return test;
+}
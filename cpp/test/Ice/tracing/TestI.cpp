@@ -0,0 +1,43 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <TestI.h>
+
+using namespace std;
+
+void
+TestI::op(const Ice::Current&)
+{
+}
+
+void
+TestI::forward(const Test::TestIntfPrx& target, const Ice::Current&)
+{
+    target->op();
+}
+
+void
+TestI::throwUserException(const Ice::Current&)
+{
+    throw Test::TestException();
+}
+
+string
+TestI::getTraceParent(const Ice::Current& current)
+{
+    Ice::Context::const_iterator p = current.ctx.find("traceparent");
+    return p != current.ctx.end() ? p->second : string();
+}
+
+void
+TestI::shutdown(const Ice::Current& current)
+{
+    current.adapter->getCommunicator()->shutdown();
+}
@@ -0,0 +1,26 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef TEST_I_H
+#define TEST_I_H
+
+#include <Test.h>
+
+class TestI : public Test::TestIntf
+{
+public:
+
+    virtual void op(const Ice::Current&);
+    virtual void forward(const Test::TestIntfPrx&, const Ice::Current&);
+    virtual void throwUserException(const Ice::Current&);
+    virtual std::string getTraceParent(const Ice::Current&);
+    virtual void shutdown(const Ice::Current&);
+};
+
+#endif
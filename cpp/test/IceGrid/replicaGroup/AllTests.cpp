@@ -1006,3 +1006,93 @@ allTests(const Ice::CommunicatorPtr& comm)
 
     session->destroy();
 }
+
+void
+allTestsWithTwoChoices(const Ice::CommunicatorPtr& comm)
+{
+    IceGrid::RegistryPrx registry = IceGrid::RegistryPrx::checkedCast(
+        comm->stringToProxy(comm->getDefaultLocator()->ice_getIdentity().category + "/Registry"));
+    test(registry);
+    AdminSessionPrx session = registry->createAdminSession("foo", "bar");
+
+    session->ice_getConnection()->setACM(registry->getACMTimeout(), IceUtil::None, Ice::HeartbeatAlways);
+
+    AdminPrx admin = session->getAdmin();
+    test(admin);
+
+    set<string> serverReplicaIds;
+    serverReplicaIds.insert("Server1.ReplicatedAdapter");
+    serverReplicaIds.insert("Server2.ReplicatedAdapter");
+    serverReplicaIds.insert("Server3.ReplicatedAdapter");
+    serverReplicaIds.insert("Server4.ReplicatedAdapter");
+
+    cout << "testing adaptive load balancing with two choices... " << flush;
+    {
+        //
+        // The replicas are on the same node and have the same load, each
+        // replica must eventually be chosen.
+        //
+        map<string, string> params;
+        params["replicaGroup"] = "Adaptive";
+        params["id"] = "Server1";
+        instantiateServer(admin, "Server", "localnode", params);
+        params["id"] = "Server2";
+        instantiateServer(admin, "Server", "localnode", params);
+        params["id"] = "Server3";
+        instantiateServer(admin, "Server", "localnode", params);
+        params["id"] = "Server4";
+        instantiateServer(admin, "Server", "localnode", params);
+        TestIntfPrx obj = TestIntfPrx::uncheckedCast(comm->stringToProxy("Adaptive"));
+        obj = TestIntfPrx::uncheckedCast(obj->ice_locatorCacheTimeout(0));
+        obj = TestIntfPrx::uncheckedCast(obj->ice_connectionCached(false));
+        set<string> replicaIds = serverReplicaIds;
+        while(!replicaIds.empty())
+        {
+            try
+            {
+                string id = obj->getReplicaId();
+                test(serverReplicaIds.find(id) != serverReplicaIds.end());
+                replicaIds.erase(id);
+            }
+            catch(const Ice::LocalException& ex)
+            {
+                cerr << ex << endl;
+                test(false);
+            }
+        }
+        removeServer(admin, "Server1");
+        removeServer(admin, "Server2");
+        removeServer(admin, "Server3");
+        removeServer(admin, "Server4");
+    }
+    {
+        //
+        // Only one replica is reachable, it must be returned even if the
+        // two replicas chosen are unreachable.
+        //
+        map<string, string> params;
+        params["replicaGroup"] = "Adaptive";
+        params["id"] = "Server1";
+        instantiateServer(admin, "Server", "inactivenode", params);
+        params["id"] = "Server2";
+        instantiateServer(admin, "Server", "inactivenode", params);
+        params["id"] = "Server3";
+        instantiateServer(admin, "Server", "inactivenode", params);
+        params["id"] = "Server4";
+        instantiateServer(admin, "Server", "localnode", params);
+        TestIntfPrx obj = TestIntfPrx::uncheckedCast(comm->stringToProxy("Adaptive"));
+        obj = TestIntfPrx::uncheckedCast(obj->ice_locatorCacheTimeout(0));
+        obj = TestIntfPrx::uncheckedCast(obj->ice_connectionCached(false));
+        for(int i = 0; i < 20; ++i)
+        {
+            test(obj->getReplicaId() == "Server4.ReplicatedAdapter");
+        }
+        removeServer(admin, "Server1");
+        removeServer(admin, "Server2");
+        removeServer(admin, "Server3");
+        removeServer(admin, "Server4");
+    }
+    cout << "ok" << endl;
+
+    session->destroy();
+}
@@ -14,10 +14,28 @@
 using namespace std;
 
 int
-run(int, char**, const Ice::CommunicatorPtr& communicator)
+run(int argc, char* argv[], const Ice::CommunicatorPtr& communicator)
 {
-    void allTests(const Ice::CommunicatorPtr&);
-    allTests(communicator);
+    bool withTwoChoices = false;
+    for(int i = 1; i < argc; ++i)
+    {
+        if(strcmp(argv[i], "--two-choices") == 0)
+        {
+            withTwoChoices = true;
+            break;
+        }
+    }
+
+    if(!withTwoChoices)
+    {
+        void allTests(const Ice::CommunicatorPtr&);
+        allTests(communicator);
+    }
+    else
+    {
+        void allTestsWithTwoChoices(const Ice::CommunicatorPtr&);
+        allTestsWithTwoChoices(communicator);
+    }
     return EXIT_SUCCESS;
 }
 
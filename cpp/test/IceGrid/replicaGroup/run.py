@@ -31,3 +31,8 @@ IceGridAdmin.nreplicas=0
 IceGridAdmin.registryOptions += " --Ice.Plugin.RegistryPlugin=RegistryPlugin:createRegistryPlugin"
 
 IceGridAdmin.iceGridTest("application.xml", "--Ice.RetryIntervals=\"0 50 100 250\"", "icebox.exe='%s'" % TestUtil.getIceBox())
+
+print("Running test with IceGrid.Registry.AdaptiveTwoChoices...")
+IceGridAdmin.registryOptions += " --IceGrid.Registry.AdaptiveTwoChoices=1"
+IceGridAdmin.iceGridTest("application.xml", "--Ice.RetryIntervals=\"0 50 100 250\" --two-choices",
+                         "icebox.exe='%s'" % TestUtil.getIceBox())
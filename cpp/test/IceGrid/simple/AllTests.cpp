@@ -162,6 +162,37 @@ allTestsWithDeploy(const Ice::CommunicatorPtr& communicator)
     obj2->ice_ping();
     cout << "ok" << endl;
 
+    cout << "testing batched adapter lookup... " << flush;
+    {
+        IceGrid::LocatorPrx locator = IceGrid::LocatorPrx::uncheckedCast(communicator->getDefaultLocator());
+        Ice::StringSeq ids;
+        ids.push_back("TestAdapter");
+        ids.push_back("UnknownAdapter");
+        Ice::ObjectProxySeq proxies = locator->findAdaptersById(ids);
+        test(proxies.size() == 2);
+        test(proxies[0] && !proxies[0]->ice_getEndpoints().empty());
+        test(!proxies[1]);
+        test(locator->findAdaptersById(Ice::StringSeq()).empty());
+
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.BatchLocatorRequests", "1");
+        Ice::CommunicatorPtr com = Ice::initialize(initData);
+        Ice::AsyncResultPtr r1 = com->stringToProxy("test @ TestAdapter")->begin_ice_ping();
+        Ice::AsyncResultPtr r2 = com->stringToProxy("test @ UnknownAdapter")->begin_ice_ping();
+        r1->getProxy()->end_ice_ping(r1);
+        try
+        {
+            r2->getProxy()->end_ice_ping(r2);
+            test(false);
+        }
+        catch(const Ice::NotRegisteredException&)
+        {
+        }
+        com->destroy();
+    }
+    cout << "ok" << endl;
+
     cout << "testing encoding versioning... " << flush;
     Ice::ObjectPrx base10 = communicator->stringToProxy("test10 @ TestAdapter10");
     test(base10);
@@ -1638,6 +1638,108 @@ allTests(const CommunicatorPtr& communicator, const string& testDir, bool p12, b
     cout << "ok" << endl;
 #endif
 
+#ifdef ICE_USE_OPENSSL
+    cout << "testing session resumption... " << flush;
+    {
+        InitializationData initData;
+        initData.properties = createClientProps(defaultProps, defaultDir, defaultHost, p12, "c_rsa_ca1", "cacert1");
+        initData.properties->setProperty("IceSSL.SessionCacheSize", "10");
+        CommunicatorPtr comm = initialize(initData);
+        Test::ServerFactoryPrx fact = Test::ServerFactoryPrx::checkedCast(comm->stringToProxy(factoryRef));
+        test(fact);
+        Test::Properties d = createServerProps(defaultProps, defaultDir, defaultHost, p12, "s_rsa_ca1", "cacert1");
+        d["IceSSL.SessionCacheSize"] = "10";
+        Test::ServerPrx server = fact->createServer(d);
+        try
+        {
+            server->ice_ping();
+            IceSSL::NativeConnectionInfoPtr info =
+                IceSSL::NativeConnectionInfoPtr::dynamicCast(server->ice_getConnection()->getInfo());
+            test(!info->resumed);
+            test(!info->certs.empty() && !info->nativeCerts.empty());
+            IceSSL::DistinguishedName subjectDN = info->nativeCerts[0]->getSubjectDN();
+            server->ice_getConnection()->close(false);
+
+            //
+            // The session established by the first connection is resumed,
+            // the peer certificates are still available.
+            //
+            server->ice_ping();
+            info = IceSSL::NativeConnectionInfoPtr::dynamicCast(server->ice_getConnection()->getInfo());
+            test(info->resumed);
+            test(!info->certs.empty() && !info->nativeCerts.empty());
+            test(info->nativeCerts[0]->getSubjectDN() == subjectDN);
+        }
+        catch(const LocalException& ex)
+        {
+            cerr << ex << endl;
+            test(false);
+        }
+        fact->destroyServer(server);
+        comm->destroy();
+    }
+    cout << "ok" << endl;
+
+    cout << "testing kernel TLS... " << flush;
+    {
+        //
+        // Kernel TLS is only used if the kernel supports it for the negotiated
+        // cipher, otherwise the records are still encrypted by OpenSSL.
+        // Session caching is enabled to get the server to send session
+        // tickets, with TLS 1.3 these are sent after the handshake and are
+        // received along with the application data.
+        //
+        InitializationData initData;
+        initData.properties = createClientProps(defaultProps, defaultDir, defaultHost, p12, "c_rsa_ca1", "cacert1");
+        initData.properties->setProperty("IceSSL.KernelTLS", "1");
+        initData.properties->setProperty("IceSSL.SessionCacheSize", "10");
+        CommunicatorPtr comm = initialize(initData);
+        Test::ServerFactoryPrx fact = Test::ServerFactoryPrx::checkedCast(comm->stringToProxy(factoryRef));
+        test(fact);
+        Test::Properties d = createServerProps(defaultProps, defaultDir, defaultHost, p12, "s_rsa_ca1", "cacert1");
+        d["IceSSL.KernelTLS"] = "1";
+        d["IceSSL.SessionCacheSize"] = "10";
+        Test::ServerPrx server = fact->createServer(d);
+        try
+        {
+            for(int size = 1; size <= 1024 * 1024; size *= 32)
+            {
+                Ice::ByteSeq seq(size);
+                for(int i = 0; i < size; ++i)
+                {
+                    seq[i] = static_cast<Ice::Byte>(i);
+                }
+                test(server->echo(seq) == seq);
+            }
+
+            //
+            // Close the connection gracefully, each side receives the
+            // close_notify alert of its peer. The new connection resumes
+            // the session with the ticket received on the first one.
+            //
+            IceSSL::NativeConnectionInfoPtr info =
+                IceSSL::NativeConnectionInfoPtr::dynamicCast(server->ice_getConnection()->getInfo());
+            test(!info->resumed);
+            server->ice_getConnection()->close(false);
+
+            Ice::ByteSeq seq(1024);
+            test(server->echo(seq) == seq);
+            info = IceSSL::NativeConnectionInfoPtr::dynamicCast(server->ice_getConnection()->getInfo());
+            test(info->resumed);
+            server->ice_getConnection()->close(false);
+            test(server->echo(seq) == seq);
+        }
+        catch(const LocalException& ex)
+        {
+            cerr << ex << endl;
+            test(false);
+        }
+        fact->destroyServer(server);
+        comm->destroy();
+    }
+    cout << "ok" << endl;
+#endif
+
     cout << "testing multiple CA certificates... " << flush;
     {
         InitializationData initData;
@@ -67,6 +67,12 @@ ServerI::checkCipher(const string& cipher, const Ice::Current& c)
     }
 }
 
+Ice::ByteSeq
+ServerI::echo(const Ice::ByteSeq& seq, const Ice::Current&)
+{
+    return seq;
+}
+
 void
 ServerI::destroy()
 {
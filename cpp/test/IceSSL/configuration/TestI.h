@@ -21,6 +21,7 @@ public:
     virtual void noCert(const Ice::Current&);
     virtual void checkCert(const std::string&, const std::string&, const Ice::Current&);
     virtual void checkCipher(const std::string&, const Ice::Current&);
+    virtual Ice::ByteSeq echo(const Ice::ByteSeq&, const Ice::Current&);
 
     void destroy();
 
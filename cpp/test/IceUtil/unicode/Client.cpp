@@ -212,8 +212,31 @@ main(int argc, char* argv[])
             }
             catch(const IceUtil::IllegalConversionException&)
             {}
+
+            //
+            // Same with a leading ASCII run long enough to go through the
+            // word-at-a-time fast path.
+            //
+            try
+            {
+                wstring ws = IceUtil::stringToWstring("0123456789abcdefghij" + badUTF8[i]);
+                test(false);
+            }
+            catch(const IceUtil::IllegalConversionException&)
+            {}
         }     
 
+        //
+        // ASCII prefixes of every length followed by a multi-byte character.
+        //
+        for(size_t i = 0; i < 20; ++i)
+        {
+            string s = string(i, 'a') + "\xc3\xa9" + string(i, 'b');
+            wstring ws = IceUtil::stringToWstring(s);
+            test(ws == wstring(i, L'a') + wchar_t(0xE9) + wstring(i, L'b'));
+            test(IceUtil::wstringToString(ws) == s);
+        }
+
 	// TODO: need test for bad UTF-32 strings
 #ifdef _WIN32
  
@@ -21,7 +21,8 @@ Discovery.cs: \
     "$(slicedir)/IceGrid/Locator.ice" \
     "$(slicedir)/Ice/Locator.ice" \
     "$(slicedir)/Ice/Identity.ice" \
-    "$(slicedir)/Ice/ProcessF.ice"
+    "$(slicedir)/Ice/ProcessF.ice" \
+    "$(slicedir)/Ice/BuiltinSequences.ice"
 
 Exception.cs: \
     "$(slicedir)\IceGrid\Exception.ice" \
@@ -45,7 +46,8 @@ Locator.cs: \
     "$(slicedir)\IceGrid\Locator.ice" \
     "$(slicedir)/Ice/Locator.ice" \
     "$(slicedir)/Ice/Identity.ice" \
-    "$(slicedir)/Ice/ProcessF.ice"
+    "$(slicedir)/Ice/ProcessF.ice" \
+    "$(slicedir)/Ice/BuiltinSequences.ice"
 
 Observer.cs: \
     "$(slicedir)\IceGrid\Observer.ice" \
@@ -6,7 +6,7 @@
 // ICE_LICENSE file included in this distribution.
 //
 // **********************************************************************
-// Generated by makeprops.py from file ./config/PropertyNames.xml, Tue Apr 28 22:03:41 2015
+// Generated by makeprops.py from file ./config/PropertyNames.xml, Mon Oct 19 04:09:50 2026
 
 // IMPORTANT: Do not edit this file -- any edits made here will be lost!
 
@@ -35,7 +35,9 @@ public final class PropertyNames
         new Property("Ice\\.Admin\\.ACM\\.Close", false, null),
         new Property("Ice\\.Admin\\.ACM", false, null),
         new Property("Ice\\.Admin\\.AdapterId", false, null),
+        new Property("Ice\\.Admin\\.CoalesceReplies", false, null),
         new Property("Ice\\.Admin\\.Endpoints", false, null),
+        new Property("Ice\\.Admin\\.InlineDispatch", false, null),
         new Property("Ice\\.Admin\\.Locator\\.EndpointSelection", false, null),
         new Property("Ice\\.Admin\\.Locator\\.ConnectionCached", false, null),
         new Property("Ice\\.Admin\\.Locator\\.PreferSecure", false, null),
@@ -74,15 +76,18 @@ public final class PropertyNames
         new Property("Ice\\.Admin\\.Logger\\.KeepLogs", false, null),
         new Property("Ice\\.Admin\\.Logger\\.KeepTraces", false, null),
         new Property("Ice\\.Admin\\.Logger\\.Properties", false, null),
+        new Property("Ice\\.Admin\\.Metrics\\.HttpResource", false, null),
         new Property("Ice\\.Admin\\.ServerId", false, null),
         new Property("Ice\\.BackgroundLocatorCacheUpdates", false, null),
         new Property("Ice\\.BatchAutoFlush", true, null),
         new Property("Ice\\.BatchAutoFlushSize", false, null),
+        new Property("Ice\\.BatchLocatorRequests", false, null),
         new Property("Ice\\.ChangeUser", false, null),
         new Property("Ice\\.ClientAccessPolicyProtocol", false, null),
         new Property("Ice\\.Compression\\.Level", false, null),
         new Property("Ice\\.CollectObjects", false, null),
         new Property("Ice\\.Config", false, null),
+        new Property("Ice\\.ConnectionPoolSize", false, null),
         new Property("Ice\\.ConsoleListener", false, null),
         new Property("Ice\\.Default\\.CollocationOptimized", false, null),
         new Property("Ice\\.Default\\.EncodingVersion", false, null),
@@ -118,6 +123,8 @@ public final class PropertyNames
         new Property("Ice\\.Default\\.Timeout", false, null),
         new Property("Ice\\.EventLog\\.Source", false, null),
         new Property("Ice\\.FactoryAssemblies", false, null),
+        new Property("Ice\\.HostResolver\\.CacheTimeout", false, null),
+        new Property("Ice\\.HostResolver\\.NegativeCacheTimeout", false, null),
         new Property("Ice\\.HTTPProxyHost", false, null),
         new Property("Ice\\.HTTPProxyPort", false, null),
         new Property("Ice\\.ImplicitContext", false, null),
@@ -135,6 +142,7 @@ public final class PropertyNames
         new Property("Ice\\.Override\\.Timeout", false, null),
         new Property("Ice\\.Override\\.Secure", false, null),
         new Property("Ice\\.Package\\.[^\\s]+", false, null),
+        new Property("Ice\\.ParallelConnectDelay", false, null),
         new Property("Ice\\.Plugin\\.[^\\s]+", false, null),
         new Property("Ice\\.PluginLoadOrder", false, null),
         new Property("Ice\\.PreferIPv6Address", false, null),
@@ -172,11 +180,18 @@ public final class PropertyNames
         new Property("Ice\\.Trace\\.Retry", false, null),
         new Property("Ice\\.Trace\\.Slicing", false, null),
         new Property("Ice\\.Trace\\.ThreadPool", false, null),
+        new Property("Ice\\.Tracer\\.BufferSize", false, null),
+        new Property("Ice\\.Tracer\\.Enabled", false, null),
+        new Property("Ice\\.Tracer\\.File", false, null),
+        new Property("Ice\\.Tracer\\.SampleRate", false, null),
         new Property("Ice\\.UDP\\.RcvSize", false, null),
         new Property("Ice\\.UDP\\.SndSize", false, null),
         new Property("Ice\\.TCP\\.Backlog", false, null),
         new Property("Ice\\.TCP\\.RcvSize", false, null),
         new Property("Ice\\.TCP\\.SndSize", false, null),
+        new Property("Ice\\.WS\\.PerMessageDeflate", false, null),
+        new Property("Ice\\.WS\\.PerMessageDeflate\\.NoContextTakeover", false, null),
+        new Property("Ice\\.WS\\.PerMessageDeflate\\.Threshold", false, null),
         new Property("Ice\\.UseApplicationClassLoader", false, null),
         new Property("Ice\\.UseSyslog", false, null),
         new Property("Ice\\.Warn\\.AMICallback", false, null),
@@ -197,6 +212,8 @@ public final class PropertyNames
         new Property("IceMX\\.Metrics\\.[^\\s]+\\.GroupBy", false, null),
         new Property("IceMX\\.Metrics\\.[^\\s]+\\.Map", false, null),
         new Property("IceMX\\.Metrics\\.[^\\s]+\\.RetainDetached", false, null),
+        new Property("IceMX\\.Metrics\\.[^\\s]+\\.Histogram", false, null),
+        new Property("IceMX\\.Metrics\\.[^\\s]+\\.Shards", false, null),
         new Property("IceMX\\.Metrics\\.[^\\s]+\\.Accept", false, null),
         new Property("IceMX\\.Metrics\\.[^\\s]+\\.Reject", false, null),
         new Property("IceMX\\.Metrics\\.[^\\s]+", false, null),
@@ -210,7 +227,9 @@ public final class PropertyNames
         new Property("IceDiscovery\\.Multicast\\.ACM\\.Close", false, null),
         new Property("IceDiscovery\\.Multicast\\.ACM", false, null),
         new Property("IceDiscovery\\.Multicast\\.AdapterId", false, null),
+        new Property("IceDiscovery\\.Multicast\\.CoalesceReplies", false, null),
         new Property("IceDiscovery\\.Multicast\\.Endpoints", false, null),
+        new Property("IceDiscovery\\.Multicast\\.InlineDispatch", false, null),
         new Property("IceDiscovery\\.Multicast\\.Locator\\.EndpointSelection", false, null),
         new Property("IceDiscovery\\.Multicast\\.Locator\\.ConnectionCached", false, null),
         new Property("IceDiscovery\\.Multicast\\.Locator\\.PreferSecure", false, null),
@@ -247,7 +266,9 @@ public final class PropertyNames
         new Property("IceDiscovery\\.Reply\\.ACM\\.Close", false, null),
         new Property("IceDiscovery\\.Reply\\.ACM", false, null),
         new Property("IceDiscovery\\.Reply\\.AdapterId", false, null),
+        new Property("IceDiscovery\\.Reply\\.CoalesceReplies", false, null),
         new Property("IceDiscovery\\.Reply\\.Endpoints", false, null),
+        new Property("IceDiscovery\\.Reply\\.InlineDispatch", false, null),
         new Property("IceDiscovery\\.Reply\\.Locator\\.EndpointSelection", false, null),
         new Property("IceDiscovery\\.Reply\\.Locator\\.ConnectionCached", false, null),
         new Property("IceDiscovery\\.Reply\\.Locator\\.PreferSecure", false, null),
@@ -284,7 +305,9 @@ public final class PropertyNames
         new Property("IceDiscovery\\.Locator\\.ACM\\.Close", false, null),
         new Property("IceDiscovery\\.Locator\\.ACM", false, null),
         new Property("IceDiscovery\\.Locator\\.AdapterId", false, null),
+        new Property("IceDiscovery\\.Locator\\.CoalesceReplies", false, null),
         new Property("IceDiscovery\\.Locator\\.Endpoints", false, null),
+        new Property("IceDiscovery\\.Locator\\.InlineDispatch", false, null),
         new Property("IceDiscovery\\.Locator\\.Locator\\.EndpointSelection", false, null),
         new Property("IceDiscovery\\.Locator\\.Locator\\.ConnectionCached", false, null),
         new Property("IceDiscovery\\.Locator\\.Locator\\.PreferSecure", false, null),
@@ -334,7 +357,9 @@ public final class PropertyNames
         new Property("IceGridDiscovery\\.Reply\\.ACM\\.Close", false, null),
         new Property("IceGridDiscovery\\.Reply\\.ACM", false, null),
         new Property("IceGridDiscovery\\.Reply\\.AdapterId", false, null),
+        new Property("IceGridDiscovery\\.Reply\\.CoalesceReplies", false, null),
         new Property("IceGridDiscovery\\.Reply\\.Endpoints", false, null),
+        new Property("IceGridDiscovery\\.Reply\\.InlineDispatch", false, null),
         new Property("IceGridDiscovery\\.Reply\\.Locator\\.EndpointSelection", false, null),
         new Property("IceGridDiscovery\\.Reply\\.Locator\\.ConnectionCached", false, null),
         new Property("IceGridDiscovery\\.Reply\\.Locator\\.PreferSecure", false, null),
@@ -371,7 +396,9 @@ public final class PropertyNames
         new Property("IceGridDiscovery\\.Locator\\.ACM\\.Close", false, null),
         new Property("IceGridDiscovery\\.Locator\\.ACM", false, null),
         new Property("IceGridDiscovery\\.Locator\\.AdapterId", false, null),
+        new Property("IceGridDiscovery\\.Locator\\.CoalesceReplies", false, null),
         new Property("IceGridDiscovery\\.Locator\\.Endpoints", false, null),
+        new Property("IceGridDiscovery\\.Locator\\.InlineDispatch", false, null),
         new Property("IceGridDiscovery\\.Locator\\.Locator\\.EndpointSelection", false, null),
         new Property("IceGridDiscovery\\.Locator\\.Locator\\.ConnectionCached", false, null),
         new Property("IceGridDiscovery\\.Locator\\.Locator\\.PreferSecure", false, null),
@@ -469,7 +496,9 @@ public final class PropertyNames
         new Property("IceGridAdmin\\.Discovery\\.Reply\\.ACM\\.Close", false, null),
         new Property("IceGridAdmin\\.Discovery\\.Reply\\.ACM", false, null),
         new Property("IceGridAdmin\\.Discovery\\.Reply\\.AdapterId", false, null),
+        new Property("IceGridAdmin\\.Discovery\\.Reply\\.CoalesceReplies", false, null),
         new Property("IceGridAdmin\\.Discovery\\.Reply\\.Endpoints", false, null),
+        new Property("IceGridAdmin\\.Discovery\\.Reply\\.InlineDispatch", false, null),
         new Property("IceGridAdmin\\.Discovery\\.Reply\\.Locator\\.EndpointSelection", false, null),
         new Property("IceGridAdmin\\.Discovery\\.Reply\\.Locator\\.ConnectionCached", false, null),
         new Property("IceGridAdmin\\.Discovery\\.Reply\\.Locator\\.PreferSecure", false, null),
@@ -513,7 +542,9 @@ public final class PropertyNames
         new Property("IceGrid\\.AdminRouter\\.ACM\\.Close", false, null),
         new Property("IceGrid\\.AdminRouter\\.ACM", false, null),
         new Property("IceGrid\\.AdminRouter\\.AdapterId", false, null),
+        new Property("IceGrid\\.AdminRouter\\.CoalesceReplies", false, null),
         new Property("IceGrid\\.AdminRouter\\.Endpoints", false, null),
+        new Property("IceGrid\\.AdminRouter\\.InlineDispatch", false, null),
         new Property("IceGrid\\.AdminRouter\\.Locator\\.EndpointSelection", false, null),
         new Property("IceGrid\\.AdminRouter\\.Locator\\.ConnectionCached", false, null),
         new Property("IceGrid\\.AdminRouter\\.Locator\\.PreferSecure", false, null),
@@ -551,7 +582,9 @@ public final class PropertyNames
         new Property("IceGrid\\.Node\\.ACM\\.Close", false, null),
         new Property("IceGrid\\.Node\\.ACM", false, null),
         new Property("IceGrid\\.Node\\.AdapterId", false, null),
+        new Property("IceGrid\\.Node\\.CoalesceReplies", false, null),
         new Property("IceGrid\\.Node\\.Endpoints", false, null),
+        new Property("IceGrid\\.Node\\.InlineDispatch", false, null),
         new Property("IceGrid\\.Node\\.Locator\\.EndpointSelection", false, null),
         new Property("IceGrid\\.Node\\.Locator\\.ConnectionCached", false, null),
         new Property("IceGrid\\.Node\\.Locator\\.PreferSecure", false, null),
@@ -588,6 +621,7 @@ public final class PropertyNames
         new Property("IceGrid\\.Node\\.CollocateRegistry", false, null),
         new Property("IceGrid\\.Node\\.Data", false, null),
         new Property("IceGrid\\.Node\\.DisableOnFailure", false, null),
+        new Property("IceGrid\\.Node\\.MaxActivations", false, null),
         new Property("IceGrid\\.Node\\.Name", false, null),
         new Property("IceGrid\\.Node\\.Output", false, null),
         new Property("IceGrid\\.Node\\.ProcessorSocketCount", false, null),
@@ -611,6 +645,7 @@ public final class PropertyNames
         new Property("IceGrid\\.Node\\.UserAccountMapper\\.Context\\.[^\\s]+", false, null),
         new Property("IceGrid\\.Node\\.UserAccountMapper", false, null),
         new Property("IceGrid\\.Node\\.WaitTime", false, null),
+        new Property("IceGrid\\.Registry\\.AdaptiveTwoChoices", false, null),
         new Property("IceGrid\\.Registry\\.AdminCryptPasswords", false, null),
         new Property("IceGrid\\.Registry\\.AdminPermissionsVerifier\\.EndpointSelection", false, null),
         new Property("IceGrid\\.Registry\\.AdminPermissionsVerifier\\.ConnectionCached", false, null),
@@ -628,7 +663,9 @@ public final class PropertyNames
         new Property("IceGrid\\.Registry\\.AdminSessionManager\\.ACM\\.Close", false, null),
         new Property("IceGrid\\.Registry\\.AdminSessionManager\\.ACM", false, null),
         new Property("IceGrid\\.Registry\\.AdminSessionManager\\.AdapterId", false, null),
+        new Property("IceGrid\\.Registry\\.AdminSessionManager\\.CoalesceReplies", false, null),
         new Property("IceGrid\\.Registry\\.AdminSessionManager\\.Endpoints", false, null),
+        new Property("IceGrid\\.Registry\\.AdminSessionManager\\.InlineDispatch", false, null),
         new Property("IceGrid\\.Registry\\.AdminSessionManager\\.Locator\\.EndpointSelection", false, null),
         new Property("IceGrid\\.Registry\\.AdminSessionManager\\.Locator\\.ConnectionCached", false, null),
         new Property("IceGrid\\.Registry\\.AdminSessionManager\\.Locator\\.PreferSecure", false, null),
@@ -675,7 +712,9 @@ public final class PropertyNames
         new Property("IceGrid\\.Registry\\.Client\\.ACM\\.Close", false, null),
         new Property("IceGrid\\.Registry\\.Client\\.ACM", false, null),
         new Property("IceGrid\\.Registry\\.Client\\.AdapterId", false, null),
+        new Property("IceGrid\\.Registry\\.Client\\.CoalesceReplies", false, null),
         new Property("IceGrid\\.Registry\\.Client\\.Endpoints", false, null),
+        new Property("IceGrid\\.Registry\\.Client\\.InlineDispatch", false, null),
         new Property("IceGrid\\.Registry\\.Client\\.Locator\\.EndpointSelection", false, null),
         new Property("IceGrid\\.Registry\\.Client\\.Locator\\.ConnectionCached", false, null),
         new Property("IceGrid\\.Registry\\.Client\\.Locator\\.PreferSecure", false, null),
@@ -715,7 +754,9 @@ public final class PropertyNames
         new Property("IceGrid\\.Registry\\.Discovery\\.ACM\\.Close", false, null),
         new Property("IceGrid\\.Registry\\.Discovery\\.ACM", false, null),
         new Property("IceGrid\\.Registry\\.Discovery\\.AdapterId", false, null),
+        new Property("IceGrid\\.Registry\\.Discovery\\.CoalesceReplies", false, null),
         new Property("IceGrid\\.Registry\\.Discovery\\.Endpoints", false, null),
+        new Property("IceGrid\\.Registry\\.Discovery\\.InlineDispatch", false, null),
         new Property("IceGrid\\.Registry\\.Discovery\\.Locator\\.EndpointSelection", false, null),
         new Property("IceGrid\\.Registry\\.Discovery\\.Locator\\.ConnectionCached", false, null),
         new Property("IceGrid\\.Registry\\.Discovery\\.Locator\\.PreferSecure", false, null),
@@ -757,7 +798,9 @@ public final class PropertyNames
         new Property("IceGrid\\.Registry\\.Internal\\.ACM\\.Close", false, null),
         new Property("IceGrid\\.Registry\\.Internal\\.ACM", false, null),
         new Property("IceGrid\\.Registry\\.Internal\\.AdapterId", false, null),
+        new Property("IceGrid\\.Registry\\.Internal\\.CoalesceReplies", false, null),
         new Property("IceGrid\\.Registry\\.Internal\\.Endpoints", false, null),
+        new Property("IceGrid\\.Registry\\.Internal\\.InlineDispatch", false, null),
         new Property("IceGrid\\.Registry\\.Internal\\.Locator\\.EndpointSelection", false, null),
         new Property("IceGrid\\.Registry\\.Internal\\.Locator\\.ConnectionCached", false, null),
         new Property("IceGrid\\.Registry\\.Internal\\.Locator\\.PreferSecure", false, null),
@@ -809,7 +852,9 @@ public final class PropertyNames
         new Property("IceGrid\\.Registry\\.Server\\.ACM\\.Close", false, null),
         new Property("IceGrid\\.Registry\\.Server\\.ACM", false, null),
         new Property("IceGrid\\.Registry\\.Server\\.AdapterId", false, null),
+        new Property("IceGrid\\.Registry\\.Server\\.CoalesceReplies", false, null),
         new Property("IceGrid\\.Registry\\.Server\\.Endpoints", false, null),
+        new Property("IceGrid\\.Registry\\.Server\\.InlineDispatch", false, null),
         new Property("IceGrid\\.Registry\\.Server\\.Locator\\.EndpointSelection", false, null),
         new Property("IceGrid\\.Registry\\.Server\\.Locator\\.ConnectionCached", false, null),
         new Property("IceGrid\\.Registry\\.Server\\.Locator\\.PreferSecure", false, null),
@@ -847,7 +892,9 @@ public final class PropertyNames
         new Property("IceGrid\\.Registry\\.SessionManager\\.ACM\\.Close", false, null),
         new Property("IceGrid\\.Registry\\.SessionManager\\.ACM", false, null),
         new Property("IceGrid\\.Registry\\.SessionManager\\.AdapterId", false, null),
+        new Property("IceGrid\\.Registry\\.SessionManager\\.CoalesceReplies", false, null),
         new Property("IceGrid\\.Registry\\.SessionManager\\.Endpoints", false, null),
+        new Property("IceGrid\\.Registry\\.SessionManager\\.InlineDispatch", false, null),
         new Property("IceGrid\\.Registry\\.SessionManager\\.Locator\\.EndpointSelection", false, null),
         new Property("IceGrid\\.Registry\\.SessionManager\\.Locator\\.ConnectionCached", false, null),
         new Property("IceGrid\\.Registry\\.SessionManager\\.Locator\\.PreferSecure", false, null),
@@ -920,7 +967,9 @@ public final class PropertyNames
         new Property("IcePatch2\\.ACM\\.Close", false, null),
         new Property("IcePatch2\\.ACM", false, null),
         new Property("IcePatch2\\.AdapterId", false, null),
+        new Property("IcePatch2\\.CoalesceReplies", false, null),
         new Property("IcePatch2\\.Endpoints", false, null),
+        new Property("IcePatch2\\.InlineDispatch", false, null),
         new Property("IcePatch2\\.Locator\\.EndpointSelection", false, null),
         new Property("IcePatch2\\.Locator\\.ConnectionCached", false, null),
         new Property("IcePatch2\\.Locator\\.PreferSecure", false, null),
@@ -988,6 +1037,7 @@ public final class PropertyNames
         new Property("IceSSL\\.FindCert\\.[^\\s]+", true, "IceSSL.FindCert"),
         new Property("IceSSL\\.ImportCert\\.[^\\s]+", true, null),
         new Property("IceSSL\\.InitOpenSSL", false, null),
+        new Property("IceSSL\\.KernelTLS", false, null),
         new Property("IceSSL\\.KeyFile", true, null),
         new Property("IceSSL\\.KeySet", true, "IceSSL.CertStoreLocation"),
         new Property("IceSSL\\.Keychain", false, null),
@@ -1003,6 +1053,8 @@ public final class PropertyNames
         new Property("IceSSL\\.ProtocolVersionMax", false, null),
         new Property("IceSSL\\.ProtocolVersionMin", false, null),
         new Property("IceSSL\\.Random", false, null),
+        new Property("IceSSL\\.SessionCacheSize", false, null),
+        new Property("IceSSL\\.SessionCacheTimeout", false, null),
         new Property("IceSSL\\.Trace\\.Security", false, null),
         new Property("IceSSL\\.TrustOnly", false, null),
         new Property("IceSSL\\.TrustOnly\\.Client", false, null),
@@ -1033,7 +1085,9 @@ public final class PropertyNames
         new Property("Glacier2\\.Client\\.ACM\\.Close", false, null),
         new Property("Glacier2\\.Client\\.ACM", false, null),
         new Property("Glacier2\\.Client\\.AdapterId", false, null),
+        new Property("Glacier2\\.Client\\.CoalesceReplies", false, null),
         new Property("Glacier2\\.Client\\.Endpoints", false, null),
+        new Property("Glacier2\\.Client\\.InlineDispatch", false, null),
         new Property("Glacier2\\.Client\\.Locator\\.EndpointSelection", false, null),
         new Property("Glacier2\\.Client\\.Locator\\.ConnectionCached", false, null),
         new Property("Glacier2\\.Client\\.Locator\\.PreferSecure", false, null),
@@ -1108,7 +1162,9 @@ public final class PropertyNames
         new Property("Glacier2\\.Server\\.ACM\\.Close", false, null),
         new Property("Glacier2\\.Server\\.ACM", false, null),
         new Property("Glacier2\\.Server\\.AdapterId", false, null),
+        new Property("Glacier2\\.Server\\.CoalesceReplies", false, null),
         new Property("Glacier2\\.Server\\.Endpoints", false, null),
+        new Property("Glacier2\\.Server\\.InlineDispatch", false, null),
         new Property("Glacier2\\.Server\\.Locator\\.EndpointSelection", false, null),
         new Property("Glacier2\\.Server\\.Locator\\.ConnectionCached", false, null),
         new Property("Glacier2\\.Server\\.Locator\\.PreferSecure", false, null),
@@ -6,7 +6,7 @@
 // ICE_LICENSE file included in this distribution.
 //
 // **********************************************************************
-// Generated by makeprops.py from file ./config/PropertyNames.xml, Tue Apr 28 22:03:41 2015
+// Generated by makeprops.py from file ./config/PropertyNames.xml, Mon Oct 19 04:09:50 2026
 
 // IMPORTANT: Do not edit this file -- any edits made here will be lost!
 
@@ -36,7 +36,9 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Admin\.ACM\.Close/", false, null),
     new Property("/^Ice\.Admin\.ACM/", false, null),
     new Property("/^Ice\.Admin\.AdapterId/", false, null),
+    new Property("/^Ice\.Admin\.CoalesceReplies/", false, null),
     new Property("/^Ice\.Admin\.Endpoints/", false, null),
+    new Property("/^Ice\.Admin\.InlineDispatch/", false, null),
     new Property("/^Ice\.Admin\.Locator\.EndpointSelection/", false, null),
     new Property("/^Ice\.Admin\.Locator\.ConnectionCached/", false, null),
     new Property("/^Ice\.Admin\.Locator\.PreferSecure/", false, null),
@@ -75,15 +77,18 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Admin\.Logger\.KeepLogs/", false, null),
     new Property("/^Ice\.Admin\.Logger\.KeepTraces/", false, null),
     new Property("/^Ice\.Admin\.Logger\.Properties/", false, null),
+    new Property("/^Ice\.Admin\.Metrics\.HttpResource/", false, null),
     new Property("/^Ice\.Admin\.ServerId/", false, null),
     new Property("/^Ice\.BackgroundLocatorCacheUpdates/", false, null),
     new Property("/^Ice\.BatchAutoFlush/", true, null),
     new Property("/^Ice\.BatchAutoFlushSize/", false, null),
+    new Property("/^Ice\.BatchLocatorRequests/", false, null),
     new Property("/^Ice\.ChangeUser/", false, null),
     new Property("/^Ice\.ClientAccessPolicyProtocol/", false, null),
     new Property("/^Ice\.Compression\.Level/", false, null),
     new Property("/^Ice\.CollectObjects/", false, null),
     new Property("/^Ice\.Config/", false, null),
+    new Property("/^Ice\.ConnectionPoolSize/", false, null),
     new Property("/^Ice\.ConsoleListener/", false, null),
     new Property("/^Ice\.Default\.CollocationOptimized/", false, null),
     new Property("/^Ice\.Default\.EncodingVersion/", false, null),
@@ -119,6 +124,8 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Default\.Timeout/", false, null),
     new Property("/^Ice\.EventLog\.Source/", false, null),
     new Property("/^Ice\.FactoryAssemblies/", false, null),
+    new Property("/^Ice\.HostResolver\.CacheTimeout/", false, null),
+    new Property("/^Ice\.HostResolver\.NegativeCacheTimeout/", false, null),
     new Property("/^Ice\.HTTPProxyHost/", false, null),
     new Property("/^Ice\.HTTPProxyPort/", false, null),
     new Property("/^Ice\.ImplicitContext/", false, null),
@@ -136,6 +143,7 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Override\.Timeout/", false, null),
     new Property("/^Ice\.Override\.Secure/", false, null),
     new Property("/^Ice\.Package\../", false, null),
+    new Property("/^Ice\.ParallelConnectDelay/", false, null),
     new Property("/^Ice\.Plugin\../", false, null),
     new Property("/^Ice\.PluginLoadOrder/", false, null),
     new Property("/^Ice\.PreferIPv6Address/", false, null),
@@ -173,11 +181,18 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Trace\.Retry/", false, null),
     new Property("/^Ice\.Trace\.Slicing/", false, null),
     new Property("/^Ice\.Trace\.ThreadPool/", false, null),
+    new Property("/^Ice\.Tracer\.BufferSize/", false, null),
+    new Property("/^Ice\.Tracer\.Enabled/", false, null),
+    new Property("/^Ice\.Tracer\.File/", false, null),
+    new Property("/^Ice\.Tracer\.SampleRate/", false, null),
     new Property("/^Ice\.UDP\.RcvSize/", false, null),
     new Property("/^Ice\.UDP\.SndSize/", false, null),
     new Property("/^Ice\.TCP\.Backlog/", false, null),
     new Property("/^Ice\.TCP\.RcvSize/", false, null),
     new Property("/^Ice\.TCP\.SndSize/", false, null),
+    new Property("/^Ice\.WS\.PerMessageDeflate/", false, null),
+    new Property("/^Ice\.WS\.PerMessageDeflate\.NoContextTakeover/", false, null),
+    new Property("/^Ice\.WS\.PerMessageDeflate\.Threshold/", false, null),
     new Property("/^Ice\.UseApplicationClassLoader/", false, null),
     new Property("/^Ice\.UseSyslog/", false, null),
     new Property("/^Ice\.Warn\.AMICallback/", false, null),
@@ -239,7 +239,8 @@ Locator.php: \
     "$(slicedir)\IceGrid\Locator.ice" \
     "$(slicedir)/Ice/Locator.ice" \
     "$(slicedir)/Ice/Identity.ice" \
-    "$(slicedir)/Ice/ProcessF.ice"
+    "$(slicedir)/Ice/ProcessF.ice" \
+    "$(slicedir)/Ice/BuiltinSequences.ice"
 
 Observer.php: \
     "$(slicedir)\IceGrid\Observer.ice" \
@@ -262,7 +262,8 @@ IceGrid_Locator_ice.py: \
     "$(slicedir)\IceGrid\Locator.ice" \
     "$(slicedir)/Ice/Locator.ice" \
     "$(slicedir)/Ice/Identity.ice" \
-    "$(slicedir)/Ice/ProcessF.ice"
+    "$(slicedir)/Ice/ProcessF.ice" \
+    "$(slicedir)/Ice/BuiltinSequences.ice"
 
 IceGrid_Observer_ice.py: \
     "$(slicedir)\IceGrid\Observer.ice" \